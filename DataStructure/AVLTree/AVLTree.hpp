@@ -23,7 +23,9 @@ namespace DSA {
 
         static int _default_compare(const Key& key1, const Key& key2);
 
-        AVLNode<Key, Value>* _create_node(const Key& key, const Value& value);
+        template <typename... Args>
+        AVLNode<Key, Value>* _create_node(const Key& key, Args&&... args);
+        AVLNode<Key, Value>* _copy(const AVLNode<Key, Value>* root);
 
         int _height(AVLNode<Key, Value>* node) const;
         int _balance_factor(AVLNode<Key, Value>* node) const;
@@ -36,6 +38,8 @@ namespace DSA {
         AVLNode<Key, Value>* _remove(AVLNode<Key, Value>* root, const Key& key);
         void _clear(AVLNode<Key, Value>* root);
 
+        template <typename Callback>
+        void _for_each(AVLNode<Key, Value>* root, Callback& callback) const;
         void _preorder(AVLNode<Key, Value>* root, std::ostringstream& outstring) const;
         void _inorder(AVLNode<Key, Value>* root, std::ostringstream& outstring) const;
         void _postorder(AVLNode<Key, Value>* root, std::ostringstream& outstring) const;
@@ -43,8 +47,15 @@ namespace DSA {
 
     public:
         AVLTree(int (*comparator)(const Key& key1, const Key& key2) = _default_compare);
+        AVLTree(const AVLTree<Key, Value>& other);
+        AVLTree(AVLTree<Key, Value>&& other) noexcept;
+        AVLTree<Key, Value>& operator=(const AVLTree<Key, Value>& other);
+        AVLTree<Key, Value>& operator=(AVLTree<Key, Value>&& other) noexcept;
 
         void insert(const Key& key, const Value& value);
+        void insert(const Key& key, Value&& value);
+        template <typename... Args>
+        void emplace(const Key& key, Args&&... args);
         void remove(const Key& key);
 
         bool is_empty() const;
@@ -60,6 +71,9 @@ namespace DSA {
         const Value& at(const Key& key) const;
         Value& operator[](const Key& key);
 
+        template <typename Callback>
+        void for_each(Callback callback) const;
+
         std::string preorder() const;
         std::string inorder() const;
         std::string postorder() const;
@@ -23,11 +23,28 @@ namespace DSA {
     }
 
     template <typename Key, typename Value>
-    AVLTree<Key, Value>::AVLNode<Key, Value>* AVLTree<Key, Value>::_create_node(const Key& key, const Value& value) {
-        AVLNode<Key, Value>* newNode = new AVLNode<Key, Value>();
-        newNode->key = key;
-        newNode->data = value;
-        newNode->height = 0;
+    template <typename... Args>
+    AVLTree<Key, Value>::AVLNode<Key, Value>* AVLTree<Key, Value>::_create_node(const Key& key, Args&&... args) {
+        AVLNode<Key, Value>* newNode = new AVLNode<Key, Value>{key, Value(std::forward<Args>(args)...), nullptr, nullptr, 0};
+        return newNode;
+    }
+
+    template <typename Key, typename Value>
+    AVLTree<Key, Value>::AVLNode<Key, Value>* AVLTree<Key, Value>::_copy(const AVLNode<Key, Value>* root) {
+        if (root == nullptr) {
+            return nullptr;
+        }
+
+        AVLNode<Key, Value>* newNode = _create_node(root->key, root->data);
+        try {
+            newNode->left = _copy(root->left);
+            newNode->right = _copy(root->right);
+        }
+        catch (...) {
+            _clear(newNode);
+            throw;
+        }
+        newNode->height = root->height;
         return newNode;
     }
 
@@ -198,6 +215,16 @@ namespace DSA {
         }
     }
 
+    template <typename Key, typename Value>
+    template <typename Callback>
+    void AVLTree<Key, Value>::_for_each(AVLNode<Key, Value>* root, Callback& callback) const {
+        if (root != nullptr) {
+            _for_each(root->left, callback);
+            callback(root->key, root->data);
+            _for_each(root->right, callback);
+        }
+    }
+
     template <typename Key, typename Value>
     void AVLTree<Key, Value>::_preorder(AVLNode<Key, Value>* root, std::ostringstream& outstring) const {
         if (root != nullptr) {
@@ -232,10 +259,68 @@ namespace DSA {
         _compare = comparator;
     }
 
+    template <typename Key, typename Value>
+    AVLTree<Key, Value>::AVLTree(const AVLTree<Key, Value>& other) {
+        m_root = _copy(other.m_root);
+        m_size = other.m_size;
+        _compare = other._compare;
+    }
+
+    template <typename Key, typename Value>
+    AVLTree<Key, Value>::AVLTree(AVLTree<Key, Value>&& other) noexcept {
+        m_root = other.m_root;
+        m_size = other.m_size;
+        _compare = other._compare;
+        other.m_root = nullptr;
+        other.m_size = 0;
+    }
+
+    template <typename Key, typename Value>
+    AVLTree<Key, Value>& AVLTree<Key, Value>::operator=(const AVLTree<Key, Value>& other) {
+        if (this != &other) {
+            AVLTree<Key, Value> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename Key, typename Value>
+    AVLTree<Key, Value>& AVLTree<Key, Value>::operator=(AVLTree<Key, Value>&& other) noexcept {
+        if (this != &other) {
+            _clear(m_root);
+            m_root = other.m_root;
+            m_size = other.m_size;
+            _compare = other._compare;
+            other.m_root = nullptr;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
     template <typename Key, typename Value>
     void AVLTree<Key, Value>::insert(const Key& key, const Value& value) {
-        AVLNode<Key, Value>* newNode = _create_node(key, value);
-        m_root = _insert(m_root, newNode);
+        emplace(key, value);
+    }
+
+    template <typename Key, typename Value>
+    void AVLTree<Key, Value>::insert(const Key& key, Value&& value) {
+        emplace(key, std::move(value));
+    }
+
+    template <typename Key, typename Value>
+    template <typename... Args>
+    void AVLTree<Key, Value>::emplace(const Key& key, Args&&... args) {
+        AVLNode<Key, Value>* newNode = _create_node(key, std::forward<Args>(args)...);
+        try {
+            m_root = _insert(m_root, newNode);
+        }
+        catch (...) {
+            // A duplicate key leaves the tree untouched, so only the new node needs cleanup.
+            delete newNode;
+            throw;
+        }
         m_size++;
     }
 
@@ -354,10 +439,16 @@ namespace DSA {
             }
         }
 
-        insert(key, Value());
+        emplace(key);
         return operator[](key);
     }
 
+    template <typename Key, typename Value>
+    template <typename Callback>
+    void AVLTree<Key, Value>::for_each(Callback callback) const {
+        _for_each(m_root, callback);
+    }
+
     template <typename Key, typename Value>
     std::string AVLTree<Key, Value>::preorder() const {
         std::ostringstream outstring;
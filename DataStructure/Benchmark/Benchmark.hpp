@@ -0,0 +1,63 @@
+#ifndef CPPDSA_DATA_STRUCTURE_BENCHMARK_HPP_
+#define CPPDSA_DATA_STRUCTURE_BENCHMARK_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "Timer.hpp"
+
+// Shared by the benchmark programs. It replaces the global allocation
+// functions, so it must be included by exactly one translation unit of a
+// program, the benchmark's own .cpp file.
+//
+// Every allocation is prefixed with its size so that a benchmark can report
+// the live heap bytes and the number of allocations held by a container. The
+// allocator's own per-block header is not included, so containers that make
+// many small allocations cost a little more in practice than reported.
+static std::size_t g_liveBytes = 0;
+static std::size_t g_liveBlocks = 0;
+
+// Kept out of line so that the compiler does not see through the size prefix.
+#if defined(__GNUC__)
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+
+BENCH_NOINLINE void* operator new(std::size_t size) {
+    std::size_t* block = static_cast<std::size_t*>(std::malloc(size + sizeof(std::max_align_t)));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *block = size;
+    g_liveBytes += size;
+    g_liveBlocks++;
+    return reinterpret_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+BENCH_NOINLINE void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+BENCH_NOINLINE void operator delete(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        std::size_t* block = reinterpret_cast<std::size_t*>(static_cast<char*>(pointer) - sizeof(std::max_align_t));
+        g_liveBytes -= *block;
+        g_liveBlocks--;
+        std::free(block);
+    }
+}
+
+BENCH_NOINLINE void operator delete[](void* pointer) noexcept {
+    operator delete(pointer);
+}
+
+BENCH_NOINLINE void operator delete(void* pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
+
+BENCH_NOINLINE void operator delete[](void* pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_BENCHMARK_HPP_
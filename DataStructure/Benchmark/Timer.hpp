@@ -0,0 +1,21 @@
+#ifndef CPPDSA_DATA_STRUCTURE_BENCHMARK_TIMER_HPP_
+#define CPPDSA_DATA_STRUCTURE_BENCHMARK_TIMER_HPP_
+
+#include <chrono>
+
+// Shared by the benchmark programs. Unlike Benchmark.hpp it does not replace
+// the allocation functions, so benchmarks that only measure time can use it
+// without paying for the counting allocator.
+inline double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline double elapsed_s(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_BENCHMARK_TIMER_HPP_
@@ -0,0 +1,130 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "../AVLTree/AVLTree.hpp"
+#include "../BinarySearchTree/BinarySearchTree.hpp"
+#include "../Deque/Deque.hpp"
+#include "../LinkedList/LinkedList.hpp"
+#include "../Queue/Queue.hpp"
+#include "../Stack/Stack.hpp"
+#include "Timer.hpp"
+
+// Compares inserting by copy, by move and by in-place construction for every
+// node-based container, then compares copying a whole container with moving it.
+// Payloads are std::string values: a short one that still needs a heap buffer
+// and a 1 KB one.
+
+static std::size_t g_elements = 200000;
+
+static void report(const char* container, const char* operation, double totalNs, std::size_t count) {
+    std::cout << "  " << container << " " << operation << ": " << totalNs / count << " ns/op" << std::endl;
+}
+
+// Each insert helper builds the payload from (length, fill) so that the three
+// variants do the same amount of work apart from how the value reaches the node.
+struct StackOps {
+    typedef DSA::Stack<std::string> Container;
+    static void copy(Container& c, std::size_t, const std::string& v) { c.push(v); }
+    static void move(Container& c, std::size_t, std::string&& v) { c.push(std::move(v)); }
+    static void emplace(Container& c, std::size_t, std::size_t n, char f) { c.emplace(n, f); }
+};
+
+struct QueueOps {
+    typedef DSA::Queue<std::string> Container;
+    static void copy(Container& c, std::size_t, const std::string& v) { c.enqueue(v); }
+    static void move(Container& c, std::size_t, std::string&& v) { c.enqueue(std::move(v)); }
+    static void emplace(Container& c, std::size_t, std::size_t n, char f) { c.emplace(n, f); }
+};
+
+struct DequeOps {
+    typedef DSA::Deque<std::string> Container;
+    static void copy(Container& c, std::size_t, const std::string& v) { c.push_back(v); }
+    static void move(Container& c, std::size_t, std::string&& v) { c.push_back(std::move(v)); }
+    static void emplace(Container& c, std::size_t, std::size_t n, char f) { c.emplace_back(n, f); }
+};
+
+struct LinkedListOps {
+    typedef DSA::LinkedList<std::string> Container;
+    static void copy(Container& c, std::size_t, const std::string& v) { c.push_back(v); }
+    static void move(Container& c, std::size_t, std::string&& v) { c.push_back(std::move(v)); }
+    static void emplace(Container& c, std::size_t, std::size_t n, char f) { c.emplace_back(n, f); }
+};
+
+// The BST orders by payload, so the payload carries the (scrambled) index as a prefix.
+struct BinarySearchTreeOps {
+    typedef DSA::BinarySearchTree<std::string> Container;
+    static std::string key(std::size_t i) { return std::to_string((i * 2654435761u) % 4294967291u); }
+    static void copy(Container& c, std::size_t i, const std::string& v) { std::string s = key(i) + v; c.insert(s); }
+    static void move(Container& c, std::size_t i, std::string&& v) { std::string s = key(i) + v; c.insert(std::move(s)); }
+    static void emplace(Container& c, std::size_t i, std::size_t n, char f) { c.emplace(key(i) + std::string(n, f)); }
+};
+
+struct AVLTreeOps {
+    typedef DSA::AVLTree<std::size_t, std::string> Container;
+    static void copy(Container& c, std::size_t i, const std::string& v) { c.insert(i, v); }
+    static void move(Container& c, std::size_t i, std::string&& v) { c.insert(i, std::move(v)); }
+    static void emplace(Container& c, std::size_t i, std::size_t n, char f) { c.emplace(i, n, f); }
+};
+
+template <typename Ops>
+static void bench(const char* name, std::size_t payload) {
+    const char fill = 'x';
+
+    {
+        typename Ops::Container container;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < g_elements; i++) {
+            std::string value(payload, fill);
+            Ops::copy(container, i, value);
+        }
+        report(name, "insert(const T&)", elapsed_ns(start), g_elements);
+    }
+
+    {
+        typename Ops::Container container;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < g_elements; i++) {
+            std::string value(payload, fill);
+            Ops::move(container, i, std::move(value));
+        }
+        report(name, "insert(T&&)     ", elapsed_ns(start), g_elements);
+    }
+
+    typename Ops::Container container;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < g_elements; i++) {
+        Ops::emplace(container, i, payload, fill);
+    }
+    report(name, "emplace         ", elapsed_ns(start), g_elements);
+
+    start = std::chrono::steady_clock::now();
+    typename Ops::Container copied(container);
+    report(name, "copy construct  ", elapsed_ns(start), 1);
+
+    start = std::chrono::steady_clock::now();
+    typename Ops::Container moved(std::move(container));
+    report(name, "move construct  ", elapsed_ns(start), 1);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        g_elements = std::strtoull(argv[1], nullptr, 10);
+    }
+
+    const std::size_t payloads[] = {32, 1024};
+    for (std::size_t i = 0; i < sizeof(payloads) / sizeof(payloads[0]); i++) {
+        std::cout << "elements: " << g_elements << " | payload: " << payloads[i] << " bytes" << std::endl;
+        bench<StackOps>("Stack           ", payloads[i]);
+        bench<QueueOps>("Queue           ", payloads[i]);
+        bench<DequeOps>("Deque           ", payloads[i]);
+        bench<LinkedListOps>("LinkedList      ", payloads[i]);
+        bench<BinarySearchTreeOps>("BinarySearchTree", payloads[i]);
+        bench<AVLTreeOps>("AVLTree         ", payloads[i]);
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
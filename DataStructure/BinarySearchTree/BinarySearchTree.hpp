@@ -15,7 +15,9 @@ namespace DSA {
             BSTNode<U>* right;
         };
 
-        BSTNode<T>* _create_node(const T& value);
+        template <typename... Args>
+        BSTNode<T>* _create_node(Args&&... args);
+        BSTNode<T>* _copy(const BSTNode<T>* rootNode);
         static int _default_compare(const T& value1, const T& value2);
         BSTNode<T>* _get_reference(BSTNode<T>* rootNode, const T& value);
 
@@ -36,8 +38,15 @@ namespace DSA {
 
     public:
         BinarySearchTree(int (*compare)(const T&, const T&) = _default_compare);
+        BinarySearchTree(const BinarySearchTree<T>& other);
+        BinarySearchTree(BinarySearchTree<T>&& other) noexcept;
+        BinarySearchTree<T>& operator=(const BinarySearchTree<T>& other);
+        BinarySearchTree<T>& operator=(BinarySearchTree<T>&& other) noexcept;
         
         void insert(const T& value);
+        void insert(T&& value);
+        template <typename... Args>
+        void emplace(Args&&... args);
         void remove(const T& value);
 
         bool contains(const T& value) const;
@@ -4,15 +4,32 @@
 #include <cstddef>
 #include <stdexcept>
 #include <sstream>
+#include <utility>
 #include "BinarySearchTree.hpp"
 
 namespace DSA {
     template <typename T>
-    BinarySearchTree<T>::BSTNode<T>* BinarySearchTree<T>::_create_node(const T& value) {
-        BSTNode<T>* newNode = new BSTNode<T>();
-        newNode->data = value;
-        newNode->left = nullptr;
-        newNode->right = nullptr;
+    template <typename... Args>
+    BinarySearchTree<T>::BSTNode<T>* BinarySearchTree<T>::_create_node(Args&&... args) {
+        BSTNode<T>* newNode = new BSTNode<T>{T(std::forward<Args>(args)...), nullptr, nullptr};
+        return newNode;
+    }
+
+    template <typename T>
+    BinarySearchTree<T>::BSTNode<T>* BinarySearchTree<T>::_copy(const BSTNode<T>* rootNode) {
+        if (rootNode == nullptr) {
+            return nullptr;
+        }
+
+        BSTNode<T>* newNode = _create_node(rootNode->data);
+        try {
+            newNode->left = _copy(rootNode->left);
+            newNode->right = _copy(rootNode->right);
+        }
+        catch (...) {
+            _clear(newNode);
+            throw;
+        }
         return newNode;
     }
 
@@ -263,9 +280,61 @@ namespace DSA {
         m_size = 0;
     }
 
+    template <typename T>
+    BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree<T>& other) {
+        m_root = _copy(other.m_root);
+        _compare = other._compare;
+        m_size = other.m_size;
+    }
+
+    template <typename T>
+    BinarySearchTree<T>::BinarySearchTree(BinarySearchTree<T>&& other) noexcept {
+        m_root = other.m_root;
+        _compare = other._compare;
+        m_size = other.m_size;
+        other.m_root = nullptr;
+        other.m_size = 0;
+    }
+
+    template <typename T>
+    BinarySearchTree<T>& BinarySearchTree<T>::operator=(const BinarySearchTree<T>& other) {
+        if (this != &other) {
+            BinarySearchTree<T> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    BinarySearchTree<T>& BinarySearchTree<T>::operator=(BinarySearchTree<T>&& other) noexcept {
+        if (this != &other) {
+            _clear(m_root);
+            m_root = other.m_root;
+            _compare = other._compare;
+            m_size = other.m_size;
+            other.m_root = nullptr;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
     template <typename T>
     void BinarySearchTree<T>::insert(const T& value) {
-        BSTNode<T> *newNode = _create_node(value);
+        emplace(value);
+    }
+
+    template <typename T>
+    void BinarySearchTree<T>::insert(T&& value) {
+        emplace(std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void BinarySearchTree<T>::emplace(Args&&... args) {
+        BSTNode<T> *newNode = _create_node(std::forward<Args>(args)...);
+        const T& value = newNode->data;
 
         if (m_root == nullptr) {
             m_root = newNode;
@@ -0,0 +1,96 @@
+#ifndef CPPDSA_DATA_STRUCTURE_BIT_ARRAY_HPP_
+#define CPPDSA_DATA_STRUCTURE_BIT_ARRAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace DSA {
+    // A dynamic array of flags that stores 64 flags per word instead of one
+    // per byte. Besides the usual push_back/resize interface it offers
+    // operations that work on whole words at a time: counting the set bits,
+    // finding the next set bit, and combining two arrays with and/or/xor/not.
+    // Those loops use AVX2 when the compiler targets it (e.g. -mavx2 or
+    // -march=native) and plain 64-bit words otherwise.
+    //
+    // Bits past size() in the last word are always kept at zero, so whole
+    // words can be counted and scanned without masking.
+    class BitArray {
+    public:
+        static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+    private:
+        static constexpr std::size_t _WORD_BITS = 64;
+        static constexpr std::size_t _BIT_ARRAY_INIT_WORDS = 1;
+        static constexpr std::size_t _BIT_ARRAY_GROWTH_FACTOR = 2;
+
+        std::uint64_t* m_words;
+        std::size_t m_size;
+        std::size_t m_capacity;
+
+        static std::size_t _word_count(const std::size_t bits);
+        static std::size_t _popcount(const std::uint64_t word);
+        static std::size_t _countr_zero(const std::uint64_t word);
+        void _resize(const std::size_t newCapacity);
+        void _clear_tail();
+        void _check_index(const std::size_t index) const;
+        void _check_size(const BitArray& other) const;
+
+        static void _and_words(std::uint64_t* destination, const std::uint64_t* source, const std::size_t count);
+        static void _or_words(std::uint64_t* destination, const std::uint64_t* source, const std::size_t count);
+        static void _xor_words(std::uint64_t* destination, const std::uint64_t* source, const std::size_t count);
+        static void _not_words(std::uint64_t* destination, const std::size_t count);
+        static std::size_t _popcount_words(const std::uint64_t* source, const std::size_t count);
+        static std::size_t _next_nonzero_word(const std::uint64_t* source, std::size_t position, const std::size_t count);
+
+    public:
+        BitArray();
+        BitArray(const std::size_t count, const bool value = false);
+        BitArray(const BitArray& other);
+        BitArray(BitArray&& other) noexcept;
+        BitArray& operator=(const BitArray& other);
+        BitArray& operator=(BitArray&& other) noexcept;
+
+        void push_back(const bool value);
+        void pop_back();
+        void resize(const std::size_t count, const bool value = false);
+        void clear();
+
+        bool is_empty() const;
+        std::size_t size() const;
+        std::size_t capacity() const;
+        void reserve(const std::size_t newCapacity);
+        void shrink_to_fit();
+
+        void set(const std::size_t index, const bool value = true);
+        void reset(const std::size_t index);
+        void flip(const std::size_t index);
+        bool test(const std::size_t index) const;
+        bool operator[](const std::size_t index) const;
+
+        void set();
+        void reset();
+        void flip();
+
+        std::size_t count() const;
+        std::size_t find_first() const;
+        std::size_t find_next(const std::size_t index) const;
+
+        BitArray& operator&=(const BitArray& other);
+        BitArray& operator|=(const BitArray& other);
+        BitArray& operator^=(const BitArray& other);
+        BitArray operator&(const BitArray& other) const;
+        BitArray operator|(const BitArray& other) const;
+        BitArray operator^(const BitArray& other) const;
+        BitArray operator~() const;
+
+        std::uint64_t* data();
+        const std::uint64_t* data() const;
+        std::size_t word_count() const;
+
+        ~BitArray();
+    };
+}
+
+#include "BitArray.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_BIT_ARRAY_HPP_
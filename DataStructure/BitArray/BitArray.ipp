@@ -0,0 +1,473 @@
+#ifndef CPPDSA_DATA_STRUCTURE_BIT_ARRAY_IPP_
+#define CPPDSA_DATA_STRUCTURE_BIT_ARRAY_IPP_
+
+#include <algorithm>
+#if __has_include(<bit>)
+#include <bit>
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include "BitArray.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace DSA {
+    inline std::size_t BitArray::_word_count(const std::size_t bits) {
+        return (bits + _WORD_BITS - 1) / _WORD_BITS;
+    }
+
+    // std::popcount and std::countr_zero are only available from C++20
+    // onwards, so older standards fall back to the compiler builtins or, failing
+    // that, to plain loops.
+    inline std::size_t BitArray::_popcount(const std::uint64_t word) {
+#if defined(__cpp_lib_bitops)
+        return static_cast<std::size_t>(std::popcount(word));
+#elif defined(__GNUC__)
+        return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+        std::size_t count = 0;
+        for (std::uint64_t rest = word; rest != 0; rest &= rest - 1) {
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    // word must not be zero.
+    inline std::size_t BitArray::_countr_zero(const std::uint64_t word) {
+#if defined(__cpp_lib_bitops)
+        return static_cast<std::size_t>(std::countr_zero(word));
+#elif defined(__GNUC__)
+        return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+        std::size_t count = 0;
+        while ((word >> count & 1) == 0) {
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    // Whole words are copied at once, 64 flags per copy. A moved-from array
+    // has no words at all.
+    inline void BitArray::_resize(const std::size_t newCapacity) {
+        std::uint64_t* newWords = new std::uint64_t[newCapacity];
+        if (m_words != nullptr) {
+            std::memcpy(newWords, m_words, std::min(newCapacity, _word_count(m_size)) * sizeof(std::uint64_t));
+        }
+
+        delete[] m_words;
+        m_words = newWords;
+        m_capacity = newCapacity;
+    }
+
+    inline void BitArray::_clear_tail() {
+        const std::size_t usedBits = m_size % _WORD_BITS;
+        if (usedBits != 0) {
+            m_words[m_size / _WORD_BITS] &= (std::uint64_t(1) << usedBits) - 1;
+        }
+    }
+
+    inline void BitArray::_check_index(const std::size_t index) const {
+        if (index >= m_size) {
+            throw std::out_of_range("Index out of range.");
+        }
+    }
+
+    inline void BitArray::_check_size(const BitArray& other) const {
+        if (m_size != other.m_size) {
+            throw std::invalid_argument("Bit arrays differ in size.");
+        }
+    }
+
+    // The word loops only ever read count words, and count never exceeds an
+    // array's capacity. GCC cannot see that bound once a loop is inlined into
+    // code working on a small array, and warns about the 32-byte vector loads
+    // that the rounded-down loop bound never reaches.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+    inline void BitArray::_and_words(std::uint64_t* destination, const std::uint64_t* source, const std::size_t count) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const std::size_t vectorEnd = count & ~std::size_t(3);
+        for (; i < vectorEnd; i += 4) {
+            const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i));
+            const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_and_si256(first, second));
+        }
+#endif
+        for (; i < count; i++) {
+            destination[i] &= source[i];
+        }
+    }
+
+    inline void BitArray::_or_words(std::uint64_t* destination, const std::uint64_t* source, const std::size_t count) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const std::size_t vectorEnd = count & ~std::size_t(3);
+        for (; i < vectorEnd; i += 4) {
+            const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i));
+            const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_or_si256(first, second));
+        }
+#endif
+        for (; i < count; i++) {
+            destination[i] |= source[i];
+        }
+    }
+
+    inline void BitArray::_xor_words(std::uint64_t* destination, const std::uint64_t* source, const std::size_t count) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const std::size_t vectorEnd = count & ~std::size_t(3);
+        for (; i < vectorEnd; i += 4) {
+            const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i));
+            const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_xor_si256(first, second));
+        }
+#endif
+        for (; i < count; i++) {
+            destination[i] ^= source[i];
+        }
+    }
+
+    inline void BitArray::_not_words(std::uint64_t* destination, const std::size_t count) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const std::size_t vectorEnd = count & ~std::size_t(3);
+        const __m256i ones = _mm256_set1_epi64x(-1);
+        for (; i < vectorEnd; i += 4) {
+            const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_xor_si256(words, ones));
+        }
+#endif
+        for (; i < count; i++) {
+            destination[i] = ~destination[i];
+        }
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+    // The AVX2 version looks up the bit count of every 4-bit nibble in a
+    // 16-entry table with a byte shuffle, then adds the byte counts up into
+    // four 64-bit lanes.
+    inline std::size_t BitArray::_popcount_words(const std::uint64_t* source, const std::size_t count) {
+        std::size_t total = 0;
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                               0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+        __m256i sums = _mm256_setzero_si256();
+        const std::size_t vectorEnd = count & ~std::size_t(3);
+        for (; i < vectorEnd; i += 4) {
+            const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+            const __m256i low = _mm256_and_si256(words, lowNibble);
+            const __m256i high = _mm256_and_si256(_mm256_srli_epi16(words, 4), lowNibble);
+            const __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, low), _mm256_shuffle_epi8(table, high));
+            sums = _mm256_add_epi64(sums, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+        }
+        total += static_cast<std::size_t>(_mm256_extract_epi64(sums, 0)) + static_cast<std::size_t>(_mm256_extract_epi64(sums, 1))
+               + static_cast<std::size_t>(_mm256_extract_epi64(sums, 2)) + static_cast<std::size_t>(_mm256_extract_epi64(sums, 3));
+#endif
+        for (; i < count; i++) {
+            total += _popcount(source[i]);
+        }
+        return total;
+    }
+
+    // Returns the first word at or after position that has a bit set, or
+    // count if there is none. Runs of zero words are skipped four at a time.
+    inline std::size_t BitArray::_next_nonzero_word(const std::uint64_t* source, std::size_t position, const std::size_t count) {
+#if defined(__AVX2__)
+        // position need not be a multiple of four, so the last full vector
+        // ends at count rather than at a rounded-down bound.
+        for (; position + 4 <= count; position += 4) {
+            const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + position));
+            if (!_mm256_testz_si256(words, words)) {
+                break;
+            }
+        }
+#endif
+        while (position < count && source[position] == 0) {
+            position++;
+        }
+        return position;
+    }
+
+    inline BitArray::BitArray() {
+        m_words = new std::uint64_t[_BIT_ARRAY_INIT_WORDS];
+        m_size = 0;
+        m_capacity = _BIT_ARRAY_INIT_WORDS;
+    }
+
+    inline BitArray::BitArray(const std::size_t count, const bool value) {
+        m_capacity = std::max(_BIT_ARRAY_INIT_WORDS, _word_count(count));
+        m_words = new std::uint64_t[m_capacity];
+        m_size = count;
+        std::fill(m_words, m_words + _word_count(count), value ? ~std::uint64_t(0) : std::uint64_t(0));
+        _clear_tail();
+    }
+
+    inline BitArray::BitArray(const BitArray& other) {
+        m_capacity = std::max(_BIT_ARRAY_INIT_WORDS, _word_count(other.m_size));
+        m_words = new std::uint64_t[m_capacity];
+        m_size = other.m_size;
+        std::memcpy(m_words, other.m_words, _word_count(m_size) * sizeof(std::uint64_t));
+    }
+
+    inline BitArray::BitArray(BitArray&& other) noexcept {
+        m_words = other.m_words;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        other.m_words = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
+    inline BitArray& BitArray::operator=(const BitArray& other) {
+        if (this != &other) {
+            BitArray copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    inline BitArray& BitArray::operator=(BitArray&& other) noexcept {
+        if (this != &other) {
+            delete[] m_words;
+            m_words = other.m_words;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_words = nullptr;
+            other.m_size = 0;
+            other.m_capacity = 0;
+        }
+
+        return *this;
+    }
+
+    inline void BitArray::push_back(const bool value) {
+        if (m_size >= m_capacity * _WORD_BITS) {
+            _resize(std::max(_BIT_ARRAY_INIT_WORDS, m_capacity * _BIT_ARRAY_GROWTH_FACTOR));
+        }
+
+        const std::size_t word = m_size / _WORD_BITS;
+        if (m_size % _WORD_BITS == 0) {
+            m_words[word] = 0;
+        }
+        m_words[word] |= std::uint64_t(value) << (m_size % _WORD_BITS);
+        m_size++;
+    }
+
+    inline void BitArray::pop_back() {
+        if (is_empty()) {
+            throw std::underflow_error("Array is empty.");
+        }
+
+        m_size--;
+        m_words[m_size / _WORD_BITS] &= ~(std::uint64_t(1) << (m_size % _WORD_BITS));
+    }
+
+    inline void BitArray::resize(const std::size_t count, const bool value) {
+        if (count <= m_size) {
+            m_size = count;
+            _clear_tail();
+            return;
+        }
+
+        const std::size_t requiredWords = _word_count(count);
+        if (requiredWords > m_capacity) {
+            std::size_t newCapacity = std::max(_BIT_ARRAY_INIT_WORDS, m_capacity);
+            while (newCapacity < requiredWords) {
+                newCapacity *= _BIT_ARRAY_GROWTH_FACTOR;
+            }
+            _resize(newCapacity);
+        }
+
+        // The rest of the current last word is already zero.
+        if (value && m_size % _WORD_BITS != 0) {
+            m_words[m_size / _WORD_BITS] |= ~std::uint64_t(0) << (m_size % _WORD_BITS);
+        }
+        std::fill(m_words + _word_count(m_size), m_words + requiredWords, value ? ~std::uint64_t(0) : std::uint64_t(0));
+
+        m_size = count;
+        _clear_tail();
+    }
+
+    inline void BitArray::clear() {
+        delete[] m_words;
+        m_words = new std::uint64_t[_BIT_ARRAY_INIT_WORDS];
+        m_size = 0;
+        m_capacity = _BIT_ARRAY_INIT_WORDS;
+    }
+
+    inline bool BitArray::is_empty() const {
+        return m_size == 0;
+    }
+
+    inline std::size_t BitArray::size() const {
+        return m_size;
+    }
+
+    inline std::size_t BitArray::capacity() const {
+        return m_capacity * _WORD_BITS;
+    }
+
+    inline void BitArray::reserve(const std::size_t newCapacity) {
+        if (_word_count(newCapacity) > m_capacity) {
+            _resize(_word_count(newCapacity));
+        }
+    }
+
+    inline void BitArray::shrink_to_fit() {
+        _resize(std::max(_BIT_ARRAY_INIT_WORDS, _word_count(m_size)));
+    }
+
+    inline void BitArray::set(const std::size_t index, const bool value) {
+        _check_index(index);
+        const std::uint64_t mask = std::uint64_t(1) << (index % _WORD_BITS);
+        if (value) {
+            m_words[index / _WORD_BITS] |= mask;
+        }
+        else {
+            m_words[index / _WORD_BITS] &= ~mask;
+        }
+    }
+
+    inline void BitArray::reset(const std::size_t index) {
+        set(index, false);
+    }
+
+    inline void BitArray::flip(const std::size_t index) {
+        _check_index(index);
+        m_words[index / _WORD_BITS] ^= std::uint64_t(1) << (index % _WORD_BITS);
+    }
+
+    inline bool BitArray::test(const std::size_t index) const {
+        _check_index(index);
+        return (*this)[index];
+    }
+
+    inline bool BitArray::operator[](const std::size_t index) const {
+        return (m_words[index / _WORD_BITS] >> (index % _WORD_BITS)) & 1;
+    }
+
+    inline void BitArray::set() {
+        std::fill(m_words, m_words + _word_count(m_size), ~std::uint64_t(0));
+        _clear_tail();
+    }
+
+    inline void BitArray::reset() {
+        std::fill(m_words, m_words + _word_count(m_size), std::uint64_t(0));
+    }
+
+    inline void BitArray::flip() {
+        _not_words(m_words, _word_count(m_size));
+        _clear_tail();
+    }
+
+    inline std::size_t BitArray::count() const {
+        return _popcount_words(m_words, _word_count(m_size));
+    }
+
+    inline std::size_t BitArray::find_first() const {
+        const std::size_t words = _word_count(m_size);
+        const std::size_t word = _next_nonzero_word(m_words, 0, words);
+        if (word == words) {
+            return NPOS;
+        }
+        return word * _WORD_BITS + _countr_zero(m_words[word]);
+    }
+
+    // Returns the position of the first set bit after index, or NPOS if there
+    // is none.
+    inline std::size_t BitArray::find_next(const std::size_t index) const {
+        if (m_size == 0 || index >= m_size - 1) {
+            return NPOS;
+        }
+
+        const std::size_t start = index + 1;
+
+        std::size_t word = start / _WORD_BITS;
+        const std::uint64_t rest = m_words[word] & (~std::uint64_t(0) << (start % _WORD_BITS));
+        if (rest != 0) {
+            return word * _WORD_BITS + _countr_zero(rest);
+        }
+
+        const std::size_t words = _word_count(m_size);
+        word = _next_nonzero_word(m_words, word + 1, words);
+        if (word == words) {
+            return NPOS;
+        }
+        return word * _WORD_BITS + _countr_zero(m_words[word]);
+    }
+
+    inline BitArray& BitArray::operator&=(const BitArray& other) {
+        _check_size(other);
+        _and_words(m_words, other.m_words, _word_count(m_size));
+        return *this;
+    }
+
+    inline BitArray& BitArray::operator|=(const BitArray& other) {
+        _check_size(other);
+        _or_words(m_words, other.m_words, _word_count(m_size));
+        return *this;
+    }
+
+    inline BitArray& BitArray::operator^=(const BitArray& other) {
+        _check_size(other);
+        _xor_words(m_words, other.m_words, _word_count(m_size));
+        return *this;
+    }
+
+    inline BitArray BitArray::operator&(const BitArray& other) const {
+        BitArray result(*this);
+        result &= other;
+        return result;
+    }
+
+    inline BitArray BitArray::operator|(const BitArray& other) const {
+        BitArray result(*this);
+        result |= other;
+        return result;
+    }
+
+    inline BitArray BitArray::operator^(const BitArray& other) const {
+        BitArray result(*this);
+        result ^= other;
+        return result;
+    }
+
+    inline BitArray BitArray::operator~() const {
+        BitArray result(*this);
+        result.flip();
+        return result;
+    }
+
+    inline std::uint64_t* BitArray::data() {
+        return m_words;
+    }
+
+    inline const std::uint64_t* BitArray::data() const {
+        return m_words;
+    }
+
+    inline std::size_t BitArray::word_count() const {
+        return _word_count(m_size);
+    }
+
+    inline BitArray::~BitArray() {
+        delete[] m_words;
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_BIT_ARRAY_IPP_
@@ -0,0 +1,129 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../Benchmark/Benchmark.hpp"
+#include "../DynamicArray/DynamicArray.hpp"
+#include "BitArray.hpp"
+
+// Number of flags in each array and the percentage of flags that are set.
+static std::size_t g_flags = std::size_t(1) << 30;
+static double g_density = 1.0;
+
+static void report(const char* operation, double bytesMs, double bitsMs) {
+    std::cout << "  " << operation << "DynamicArray<bool> " << bytesMs << " ms (" << g_flags / bytesMs / 1e6
+              << " Gflags/s) | BitArray " << bitsMs << " ms (" << g_flags / bitsMs / 1e6 << " Gflags/s) | "
+              << bytesMs / bitsMs << "x" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_flags = std::strtoull(argv[1], nullptr, 10);
+    if (argc > 2) g_density = std::strtod(argv[2], nullptr);
+
+#if defined(__AVX2__)
+    const char* kernels = "AVX2";
+#else
+    const char* kernels = "64-bit words";
+#endif
+    std::cout << "flags: " << g_flags << " | set: " << g_density << "% | BitArray kernels: " << kernels << std::endl;
+    std::cout << std::endl;
+
+    std::mt19937_64 rng(42);
+    const std::size_t setCount = static_cast<std::size_t>(g_flags * g_density / 100);
+    std::vector<std::size_t> positions(setCount);
+    std::vector<std::size_t> otherPositions(setCount);
+    for (std::size_t i = 0; i < setCount; i++) {
+        positions[i] = rng() % g_flags;
+        otherPositions[i] = rng() % g_flags;
+    }
+
+    std::size_t baseBytes = g_liveBytes;
+    DSA::DynamicArray<bool> bytes;
+    bytes.resize(g_flags, false);
+    DSA::DynamicArray<bool> otherBytes;
+    otherBytes.resize(g_flags, false);
+    const std::size_t byteArrayBytes = (g_liveBytes - baseBytes) / 2;
+
+    baseBytes = g_liveBytes;
+    DSA::BitArray bits(g_flags, false);
+    DSA::BitArray otherBits(g_flags, false);
+    const std::size_t bitArrayBytes = (g_liveBytes - baseBytes) / 2;
+
+    std::cout << "memory per array" << std::endl;
+    std::cout << "  DynamicArray<bool> " << byteArrayBytes / (1024.0 * 1024.0) << " MiB | BitArray "
+              << bitArrayBytes / (1024.0 * 1024.0) << " MiB | " << static_cast<double>(byteArrayBytes) / bitArrayBytes
+              << "x" << std::endl;
+    std::cout << std::endl;
+
+    for (std::size_t i = 0; i < setCount; i++) {
+        bytes[positions[i]] = true;
+        otherBytes[otherPositions[i]] = true;
+        bits.set(positions[i]);
+        otherBits.set(otherPositions[i]);
+    }
+
+    std::cout << "throughput" << std::endl;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::size_t byteCount = 0;
+    for (std::size_t i = 0; i < g_flags; i++) {
+        byteCount += bytes[i];
+    }
+    double bytesMs = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    std::size_t bitCount = bits.count();
+    double bitsMs = elapsed_ms(start);
+    report("count:     ", bytesMs, bitsMs);
+
+    start = std::chrono::steady_clock::now();
+    std::size_t byteScan = 0;
+    for (std::size_t i = 0; i < g_flags; i++) {
+        if (bytes[i]) {
+            byteScan += i;
+        }
+    }
+    bytesMs = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    std::size_t bitScan = 0;
+    for (std::size_t i = bits.find_first(); i != DSA::BitArray::NPOS; i = bits.find_next(i)) {
+        bitScan += i;
+    }
+    bitsMs = elapsed_ms(start);
+    report("scan:      ", bytesMs, bitsMs);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < g_flags; i++) {
+        bytes[i] = bytes[i] || otherBytes[i];
+    }
+    bytesMs = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    bits |= otherBits;
+    bitsMs = elapsed_ms(start);
+    report("or:        ", bytesMs, bitsMs);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < g_flags; i++) {
+        bytes[i] = !bytes[i];
+    }
+    bytesMs = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    bits.flip();
+    bitsMs = elapsed_ms(start);
+    report("not:       ", bytesMs, bitsMs);
+
+    std::size_t byteAfter = 0;
+    for (std::size_t i = 0; i < g_flags; i++) {
+        byteAfter += bytes[i];
+    }
+    const bool match = byteCount == bitCount && byteScan == bitScan && byteAfter == bits.count();
+    std::cout << std::endl;
+    std::cout << "results " << (match ? "match" : "DIFFER") << " (set flags: " << bitCount << ")" << std::endl;
+    return match ? 0 : 1;
+}
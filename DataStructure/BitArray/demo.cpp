@@ -0,0 +1,53 @@
+#include <iostream>
+#include "BitArray.hpp"
+
+void printBits(const DSA::BitArray& bits, const char* expect) {
+    std::cout << "===========================" << std::endl;
+    std::cout << expect << std::endl;
+    std::cout << "Size: " << bits.size() << " | Count: " << bits.count() << std::endl;
+    std::cout << "Bits: ";
+    for (std::size_t i = 0; i < bits.size(); i++) {
+        std::cout << bits[i];
+    }
+    std::cout << std::endl;
+    std::cout << "Set positions:";
+    for (std::size_t i = bits.find_first(); i != DSA::BitArray::NPOS; i = bits.find_next(i)) {
+        std::cout << " " << i;
+    }
+    std::cout << std::endl;
+    std::cout << "===========================" << std::endl;
+}
+
+int main() {
+    std::cout << "START" << std::endl;
+
+    DSA::BitArray bits;
+    bits.push_back(true);
+    bits.push_back(false);
+    bits.push_back(true);
+    bits.push_back(true);
+    printBits(bits, "EXPECT: 1011");
+
+    bits.resize(70, false);
+    bits.set(65);
+    bits.set(69);
+    printBits(bits, "EXPECT: 70 bits, set at 0, 2, 3, 65, 69");
+
+    bits.reset(2);
+    bits.flip(1);
+    bits.pop_back();
+    printBits(bits, "EXPECT: 69 bits, set at 0, 1, 3, 65");
+
+    DSA::BitArray mask(69, false);
+    mask.set(0);
+    mask.set(3);
+    mask.set(40);
+    printBits(bits & mask, "AND with mask {0, 3, 40}. EXPECT: set at 0, 3");
+    printBits(bits | mask, "OR with mask {0, 3, 40}. EXPECT: set at 0, 1, 3, 40, 65");
+    printBits(bits ^ mask, "XOR with mask {0, 3, 40}. EXPECT: set at 1, 40, 65");
+    printBits(~bits, "NOT. EXPECT: 65 of 69 bits set, all but 0, 1, 3, 65");
+
+    std::cout << "test(65): " << bits.test(65) << " | test(66): " << bits.test(66) << std::endl;
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
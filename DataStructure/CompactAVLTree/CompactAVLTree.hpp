@@ -0,0 +1,104 @@
+#ifndef CPPDSA_DATA_STRUCTURE_COMPACT_AVL_TREE_HPP_
+#define CPPDSA_DATA_STRUCTURE_COMPACT_AVL_TREE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include "../NodePool/NodePool.hpp"
+
+namespace DSA {
+    // An AVL tree with the same interface as AVLTree but a smaller node. Nodes
+    // live in a NodePool and link to their children through 31-bit indices.
+    // Instead of a height, every node keeps its balance factor in the spare
+    // top bit of each child link: the bit on the left link is set when the
+    // left subtree is taller, the bit on the right link when the right one is.
+    template <typename Key, typename Value>
+    class CompactAVLTree {
+    private:
+        static constexpr std::uint32_t _NIL = 0x7FFFFFFFu;
+        static constexpr std::uint32_t _INDEX_MASK = 0x7FFFFFFFu;
+        static constexpr std::uint32_t _TALLER_BIT = 0x80000000u;
+
+        template <typename _Key, typename _Value>
+        struct CompactAVLNode {
+            _Key key;
+            _Value data;
+            std::uint32_t left;
+            std::uint32_t right;
+        };
+
+        NodePool<CompactAVLNode<Key, Value>> m_pool;
+        std::uint32_t m_root;
+        std::size_t m_size;
+        int (*_compare)(const Key& key1, const Key& key2);
+
+        static int _default_compare(const Key& key1, const Key& key2);
+
+        std::uint32_t _left(const std::uint32_t node) const;
+        std::uint32_t _right(const std::uint32_t node) const;
+        void _set_left(const std::uint32_t node, const std::uint32_t child);
+        void _set_right(const std::uint32_t node, const std::uint32_t child);
+        int _balance_factor(const std::uint32_t node) const;
+        void _set_balance_factor(const std::uint32_t node, const int bf);
+
+        std::uint32_t _left_rotate(const std::uint32_t root);
+        std::uint32_t _right_rotate(const std::uint32_t root);
+        std::uint32_t _fix_left_heavy(const std::uint32_t root, bool& shrunk);
+        std::uint32_t _fix_right_heavy(const std::uint32_t root, bool& shrunk);
+        std::uint32_t _left_shrunk(const std::uint32_t root, bool& shrunk);
+        std::uint32_t _right_shrunk(const std::uint32_t root, bool& shrunk);
+
+        template <typename... Args>
+        std::uint32_t _insert(const std::uint32_t root, bool& grew, const Key& key, Args&&... args);
+        std::uint32_t _remove(const std::uint32_t root, const Key& key, bool& shrunk);
+        std::uint32_t _remove_min(const std::uint32_t root, std::uint32_t& minNode, bool& shrunk);
+        std::uint32_t _find(const Key& key) const;
+        std::uint32_t _copy(const CompactAVLTree<Key, Value>& other, const std::uint32_t root);
+        void _clear(const std::uint32_t root);
+
+        template <typename Callback>
+        void _for_each(const std::uint32_t root, Callback& callback) const;
+        void _preorder(const std::uint32_t root, std::ostringstream& outstring) const;
+        void _inorder(const std::uint32_t root, std::ostringstream& outstring) const;
+        void _postorder(const std::uint32_t root, std::ostringstream& outstring) const;
+
+    public:
+        CompactAVLTree(int (*comparator)(const Key& key1, const Key& key2) = _default_compare);
+        CompactAVLTree(const CompactAVLTree<Key, Value>& other);
+        CompactAVLTree(CompactAVLTree<Key, Value>&& other) noexcept;
+        CompactAVLTree<Key, Value>& operator=(const CompactAVLTree<Key, Value>& other);
+        CompactAVLTree<Key, Value>& operator=(CompactAVLTree<Key, Value>&& other) noexcept;
+
+        void insert(const Key& key, const Value& value);
+        void insert(const Key& key, Value&& value);
+        template <typename... Args>
+        void emplace(const Key& key, Args&&... args);
+        void remove(const Key& key);
+
+        bool is_empty() const;
+        std::size_t size() const;
+
+        Value& min();
+        const Value& min() const;
+        Value& max();
+        const Value& max() const;
+
+        bool contains(const Key& key) const;
+        Value& at(const Key& key);
+        const Value& at(const Key& key) const;
+        Value& operator[](const Key& key);
+
+        template <typename Callback>
+        void for_each(Callback callback) const;
+
+        std::string preorder() const;
+        std::string inorder() const;
+        std::string postorder() const;
+
+        ~CompactAVLTree();
+    };
+}
+
+#include "CompactAVLTree.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_COMPACT_AVL_TREE_HPP_
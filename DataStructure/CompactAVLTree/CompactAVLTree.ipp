@@ -0,0 +1,560 @@
+#ifndef CPPDSA_DATA_STRUCTURE_COMPACT_AVL_TREE_IPP_
+#define CPPDSA_DATA_STRUCTURE_COMPACT_AVL_TREE_IPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <sstream>
+#include <utility>
+#include "../NodePool/NodePool.hpp"
+#include "CompactAVLTree.hpp"
+
+namespace DSA {
+    template <typename Key, typename Value>
+    int CompactAVLTree<Key, Value>::_default_compare(const Key& key1, const Key& key2) {
+        if (key1 > key2) {
+            return 1;
+        }
+        else if (key1 < key2) {
+            return -1;
+        }
+        else {
+            return 0;
+        }
+    }
+
+    template <typename Key, typename Value>
+    inline std::uint32_t CompactAVLTree<Key, Value>::_left(const std::uint32_t node) const {
+        return m_pool[node].left & _INDEX_MASK;
+    }
+
+    template <typename Key, typename Value>
+    inline std::uint32_t CompactAVLTree<Key, Value>::_right(const std::uint32_t node) const {
+        return m_pool[node].right & _INDEX_MASK;
+    }
+
+    template <typename Key, typename Value>
+    inline void CompactAVLTree<Key, Value>::_set_left(const std::uint32_t node, const std::uint32_t child) {
+        m_pool[node].left = (m_pool[node].left & _TALLER_BIT) | child;
+    }
+
+    template <typename Key, typename Value>
+    inline void CompactAVLTree<Key, Value>::_set_right(const std::uint32_t node, const std::uint32_t child) {
+        m_pool[node].right = (m_pool[node].right & _TALLER_BIT) | child;
+    }
+
+    // Height of the right subtree minus height of the left subtree.
+    template <typename Key, typename Value>
+    inline int CompactAVLTree<Key, Value>::_balance_factor(const std::uint32_t node) const {
+        return static_cast<int>(m_pool[node].right >> 31) - static_cast<int>(m_pool[node].left >> 31);
+    }
+
+    template <typename Key, typename Value>
+    inline void CompactAVLTree<Key, Value>::_set_balance_factor(const std::uint32_t node, const int bf) {
+        CompactAVLNode<Key, Value>& current = m_pool[node];
+        current.left = (current.left & _INDEX_MASK) | ((bf < 0) ? _TALLER_BIT : 0);
+        current.right = (current.right & _INDEX_MASK) | ((bf > 0) ? _TALLER_BIT : 0);
+    }
+
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_left_rotate(const std::uint32_t root) {
+        const std::uint32_t newRoot = _right(root);
+        _set_right(root, _left(newRoot));
+        _set_left(newRoot, root);
+        return newRoot;
+    }
+
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_right_rotate(const std::uint32_t root) {
+        const std::uint32_t newRoot = _left(root);
+        _set_left(root, _right(newRoot));
+        _set_right(newRoot, root);
+        return newRoot;
+    }
+
+    // Rebalances a node whose left subtree became two levels taller than its
+    // right one. Without stored heights the new balance factors follow from
+    // the old ones. shrunk reports whether the subtree ended up one level
+    // lower than before the fix, which only fails to happen when the left
+    // child was balanced (possible after a removal, never after an insert).
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_fix_left_heavy(const std::uint32_t root, bool& shrunk) {
+        const std::uint32_t left = _left(root);
+        const int leftBf = _balance_factor(left);
+
+        // Left-Left imbalance
+        if (leftBf <= 0) {
+            const std::uint32_t newRoot = _right_rotate(root);
+            if (leftBf < 0) {
+                _set_balance_factor(root, 0);
+                _set_balance_factor(newRoot, 0);
+                shrunk = true;
+            }
+            else {
+                _set_balance_factor(root, -1);
+                _set_balance_factor(newRoot, 1);
+                shrunk = false;
+            }
+            return newRoot;
+        }
+        // Left-Right imbalance
+        else {
+            const int pivotBf = _balance_factor(_right(left));
+            _set_left(root, _left_rotate(left));
+            const std::uint32_t newRoot = _right_rotate(root);
+            _set_balance_factor(root, (pivotBf < 0) ? 1 : 0);
+            _set_balance_factor(left, (pivotBf > 0) ? -1 : 0);
+            _set_balance_factor(newRoot, 0);
+            shrunk = true;
+            return newRoot;
+        }
+    }
+
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_fix_right_heavy(const std::uint32_t root, bool& shrunk) {
+        const std::uint32_t right = _right(root);
+        const int rightBf = _balance_factor(right);
+
+        // Right-Right imbalance
+        if (rightBf >= 0) {
+            const std::uint32_t newRoot = _left_rotate(root);
+            if (rightBf > 0) {
+                _set_balance_factor(root, 0);
+                _set_balance_factor(newRoot, 0);
+                shrunk = true;
+            }
+            else {
+                _set_balance_factor(root, 1);
+                _set_balance_factor(newRoot, -1);
+                shrunk = false;
+            }
+            return newRoot;
+        }
+        // Right-Left imbalance
+        else {
+            const int pivotBf = _balance_factor(_left(right));
+            _set_right(root, _right_rotate(right));
+            const std::uint32_t newRoot = _left_rotate(root);
+            _set_balance_factor(root, (pivotBf > 0) ? -1 : 0);
+            _set_balance_factor(right, (pivotBf < 0) ? 1 : 0);
+            _set_balance_factor(newRoot, 0);
+            shrunk = true;
+            return newRoot;
+        }
+    }
+
+    // Updates root after its left subtree lost one level of height.
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_left_shrunk(const std::uint32_t root, bool& shrunk) {
+        const int bf = _balance_factor(root);
+        if (bf < 0) {
+            _set_balance_factor(root, 0);
+            shrunk = true;
+            return root;
+        }
+        else if (bf == 0) {
+            _set_balance_factor(root, 1);
+            shrunk = false;
+            return root;
+        }
+
+        return _fix_right_heavy(root, shrunk);
+    }
+
+    // Updates root after its right subtree lost one level of height.
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_right_shrunk(const std::uint32_t root, bool& shrunk) {
+        const int bf = _balance_factor(root);
+        if (bf > 0) {
+            _set_balance_factor(root, 0);
+            shrunk = true;
+            return root;
+        }
+        else if (bf == 0) {
+            _set_balance_factor(root, -1);
+            shrunk = false;
+            return root;
+        }
+
+        return _fix_left_heavy(root, shrunk);
+    }
+
+    template <typename Key, typename Value>
+    template <typename... Args>
+    std::uint32_t CompactAVLTree<Key, Value>::_insert(const std::uint32_t root, bool& grew, const Key& key, Args&&... args) {
+        if (root == _NIL) {
+            grew = true;
+            return m_pool.create(key, Value(std::forward<Args>(args)...), _NIL, _NIL);
+        }
+
+        const int cmp = _compare(key, m_pool[root].key);
+        if (cmp < 0) {
+            _set_left(root, _insert(_left(root), grew, key, std::forward<Args>(args)...));
+            if (grew) {
+                const int bf = _balance_factor(root);
+                if (bf > 0) {
+                    _set_balance_factor(root, 0);
+                    grew = false;
+                }
+                else if (bf == 0) {
+                    _set_balance_factor(root, -1);
+                }
+                else {
+                    bool shrunk;
+                    grew = false;
+                    return _fix_left_heavy(root, shrunk);
+                }
+            }
+        }
+        else if (cmp > 0) {
+            _set_right(root, _insert(_right(root), grew, key, std::forward<Args>(args)...));
+            if (grew) {
+                const int bf = _balance_factor(root);
+                if (bf < 0) {
+                    _set_balance_factor(root, 0);
+                    grew = false;
+                }
+                else if (bf == 0) {
+                    _set_balance_factor(root, 1);
+                }
+                else {
+                    bool shrunk;
+                    grew = false;
+                    return _fix_right_heavy(root, shrunk);
+                }
+            }
+        }
+        else {
+            throw std::runtime_error("Key already exist.");
+        }
+
+        return root;
+    }
+
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_remove(const std::uint32_t root, const Key& key, bool& shrunk) {
+        if (root == _NIL) {
+            throw std::out_of_range("Key does not exist.");
+        }
+
+        const int cmp = _compare(key, m_pool[root].key);
+        if (cmp < 0) {
+            _set_left(root, _remove(_left(root), key, shrunk));
+            return shrunk ? _left_shrunk(root, shrunk) : root;
+        }
+        else if (cmp > 0) {
+            _set_right(root, _remove(_right(root), key, shrunk));
+            return shrunk ? _right_shrunk(root, shrunk) : root;
+        }
+
+        const std::uint32_t left = _left(root);
+        const std::uint32_t right = _right(root);
+        if (left == _NIL || right == _NIL) {
+            m_pool.destroy(root);
+            shrunk = true;
+            return (left == _NIL) ? right : left;
+        }
+
+        // Unlink the successor and put it where the removed node was, so no
+        // key or value has to be copied.
+        std::uint32_t successor = _NIL;
+        const std::uint32_t newRight = _remove_min(right, successor, shrunk);
+        m_pool[successor].left = m_pool[root].left;
+        m_pool[successor].right = m_pool[root].right;
+        _set_right(successor, newRight);
+        m_pool.destroy(root);
+
+        return shrunk ? _right_shrunk(successor, shrunk) : successor;
+    }
+
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_remove_min(const std::uint32_t root, std::uint32_t& minNode, bool& shrunk) {
+        if (_left(root) == _NIL) {
+            minNode = root;
+            shrunk = true;
+            return _right(root);
+        }
+
+        _set_left(root, _remove_min(_left(root), minNode, shrunk));
+        return shrunk ? _left_shrunk(root, shrunk) : root;
+    }
+
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_find(const Key& key) const {
+        std::uint32_t cursor = m_root;
+        while (cursor != _NIL) {
+            const int cmp = _compare(key, m_pool[cursor].key);
+            if (cmp < 0) {
+                cursor = _left(cursor);
+            }
+            else if (cmp > 0) {
+                cursor = _right(cursor);
+            }
+            else {
+                return cursor;
+            }
+        }
+
+        return _NIL;
+    }
+
+    template <typename Key, typename Value>
+    std::uint32_t CompactAVLTree<Key, Value>::_copy(const CompactAVLTree<Key, Value>& other, const std::uint32_t root) {
+        if (root == _NIL) {
+            return _NIL;
+        }
+
+        const CompactAVLNode<Key, Value>& source = other.m_pool[root];
+        const std::uint32_t newNode = m_pool.create(source.key, source.data, source.left & _TALLER_BIT, source.right & _TALLER_BIT);
+        _set_left(newNode, _NIL);
+        _set_right(newNode, _NIL);
+
+        try {
+            _set_left(newNode, _copy(other, other._left(root)));
+            _set_right(newNode, _copy(other, other._right(root)));
+        }
+        catch (...) {
+            _clear(newNode);
+            throw;
+        }
+        return newNode;
+    }
+
+    template <typename Key, typename Value>
+    void CompactAVLTree<Key, Value>::_clear(const std::uint32_t root) {
+        if (root != _NIL) {
+            _clear(_left(root));
+            _clear(_right(root));
+            m_pool.destroy(root);
+        }
+    }
+
+    template <typename Key, typename Value>
+    template <typename Callback>
+    void CompactAVLTree<Key, Value>::_for_each(const std::uint32_t root, Callback& callback) const {
+        if (root != _NIL) {
+            _for_each(_left(root), callback);
+            callback(m_pool[root].key, m_pool[root].data);
+            _for_each(_right(root), callback);
+        }
+    }
+
+    template <typename Key, typename Value>
+    void CompactAVLTree<Key, Value>::_preorder(const std::uint32_t root, std::ostringstream& outstring) const {
+        if (root != _NIL) {
+            outstring << "{" << m_pool[root].key << ":" << " " << m_pool[root].data << "} ";
+            _preorder(_left(root), outstring);
+            _preorder(_right(root), outstring);
+        }
+    }
+
+    template <typename Key, typename Value>
+    void CompactAVLTree<Key, Value>::_inorder(const std::uint32_t root, std::ostringstream& outstring) const {
+        if (root != _NIL) {
+            _inorder(_left(root), outstring);
+            outstring << "{" << m_pool[root].key << ":" << " " << m_pool[root].data << "} ";
+            _inorder(_right(root), outstring);
+        }
+    }
+
+    template <typename Key, typename Value>
+    void CompactAVLTree<Key, Value>::_postorder(const std::uint32_t root, std::ostringstream& outstring) const {
+        if (root != _NIL) {
+            _postorder(_left(root), outstring);
+            _postorder(_right(root), outstring);
+            outstring << "{" << m_pool[root].key << ":" << " " << m_pool[root].data << "} ";
+        }
+    }
+
+    template <typename Key, typename Value>
+    CompactAVLTree<Key, Value>::CompactAVLTree(int (*comparator)(const Key& key1, const Key& key2)) : m_pool(_NIL) {
+        m_root = _NIL;
+        m_size = 0;
+        _compare = comparator;
+    }
+
+    template <typename Key, typename Value>
+    CompactAVLTree<Key, Value>::CompactAVLTree(const CompactAVLTree<Key, Value>& other) : m_pool(_NIL) {
+        m_root = _copy(other, other.m_root);
+        m_size = other.m_size;
+        _compare = other._compare;
+    }
+
+    template <typename Key, typename Value>
+    CompactAVLTree<Key, Value>::CompactAVLTree(CompactAVLTree<Key, Value>&& other) noexcept : m_pool(std::move(other.m_pool)) {
+        m_root = other.m_root;
+        m_size = other.m_size;
+        _compare = other._compare;
+        other.m_root = _NIL;
+        other.m_size = 0;
+    }
+
+    template <typename Key, typename Value>
+    CompactAVLTree<Key, Value>& CompactAVLTree<Key, Value>::operator=(const CompactAVLTree<Key, Value>& other) {
+        if (this != &other) {
+            CompactAVLTree<Key, Value> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename Key, typename Value>
+    CompactAVLTree<Key, Value>& CompactAVLTree<Key, Value>::operator=(CompactAVLTree<Key, Value>&& other) noexcept {
+        if (this != &other) {
+            _clear(m_root);
+            m_pool = std::move(other.m_pool);
+            m_root = other.m_root;
+            m_size = other.m_size;
+            _compare = other._compare;
+            other.m_root = _NIL;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
+    template <typename Key, typename Value>
+    void CompactAVLTree<Key, Value>::insert(const Key& key, const Value& value) {
+        emplace(key, value);
+    }
+
+    template <typename Key, typename Value>
+    void CompactAVLTree<Key, Value>::insert(const Key& key, Value&& value) {
+        emplace(key, std::move(value));
+    }
+
+    template <typename Key, typename Value>
+    template <typename... Args>
+    void CompactAVLTree<Key, Value>::emplace(const Key& key, Args&&... args) {
+        bool grew = false;
+        m_root = _insert(m_root, grew, key, std::forward<Args>(args)...);
+        m_size++;
+    }
+
+    template <typename Key, typename Value>
+    void CompactAVLTree<Key, Value>::remove(const Key& key) {
+        if (m_root == _NIL) {
+            throw std::underflow_error("Tree is empty.");
+        }
+
+        bool shrunk = false;
+        m_root = _remove(m_root, key, shrunk);
+        m_size--;
+    }
+
+    template <typename Key, typename Value>
+    bool CompactAVLTree<Key, Value>::is_empty() const {
+        return m_size == 0;
+    }
+
+    template <typename Key, typename Value>
+    std::size_t CompactAVLTree<Key, Value>::size() const {
+        return m_size;
+    }
+
+    template <typename Key, typename Value>
+    Value& CompactAVLTree<Key, Value>::min() {
+        return const_cast<Value&>(static_cast<const CompactAVLTree<Key, Value>&>(*this).min());
+    }
+
+    template <typename Key, typename Value>
+    const Value& CompactAVLTree<Key, Value>::min() const {
+        if (m_root == _NIL) {
+            throw std::out_of_range("Tree is empty");
+        }
+
+        std::uint32_t cursor = m_root;
+        while (_left(cursor) != _NIL) {
+            cursor = _left(cursor);
+        }
+
+        return m_pool[cursor].data;
+    }
+
+    template <typename Key, typename Value>
+    Value& CompactAVLTree<Key, Value>::max() {
+        return const_cast<Value&>(static_cast<const CompactAVLTree<Key, Value>&>(*this).max());
+    }
+
+    template <typename Key, typename Value>
+    const Value& CompactAVLTree<Key, Value>::max() const {
+        if (m_root == _NIL) {
+            throw std::out_of_range("Tree is empty");
+        }
+
+        std::uint32_t cursor = m_root;
+        while (_right(cursor) != _NIL) {
+            cursor = _right(cursor);
+        }
+
+        return m_pool[cursor].data;
+    }
+
+    template <typename Key, typename Value>
+    bool CompactAVLTree<Key, Value>::contains(const Key& key) const {
+        return _find(key) != _NIL;
+    }
+
+    template <typename Key, typename Value>
+    Value& CompactAVLTree<Key, Value>::at(const Key& key) {
+        return const_cast<Value&>(static_cast<const CompactAVLTree<Key, Value>&>(*this).at(key));
+    }
+
+    template <typename Key, typename Value>
+    const Value& CompactAVLTree<Key, Value>::at(const Key& key) const {
+        const std::uint32_t node = _find(key);
+        if (node == _NIL) {
+            throw std::out_of_range("Key does not exist.");
+        }
+
+        return m_pool[node].data;
+    }
+
+    template <typename Key, typename Value>
+    Value& CompactAVLTree<Key, Value>::operator[](const Key& key) {
+        const std::uint32_t node = _find(key);
+        if (node != _NIL) {
+            return m_pool[node].data;
+        }
+
+        emplace(key);
+        return m_pool[_find(key)].data;
+    }
+
+    template <typename Key, typename Value>
+    template <typename Callback>
+    void CompactAVLTree<Key, Value>::for_each(Callback callback) const {
+        _for_each(m_root, callback);
+    }
+
+    template <typename Key, typename Value>
+    std::string CompactAVLTree<Key, Value>::preorder() const {
+        std::ostringstream outstring;
+        _preorder(m_root, outstring);
+        return outstring.str();
+    }
+
+    template <typename Key, typename Value>
+    std::string CompactAVLTree<Key, Value>::inorder() const {
+        std::ostringstream outstring;
+        _inorder(m_root, outstring);
+        return outstring.str();
+    }
+
+    template <typename Key, typename Value>
+    std::string CompactAVLTree<Key, Value>::postorder() const {
+        std::ostringstream outstring;
+        _postorder(m_root, outstring);
+        return outstring.str();
+    }
+
+    template <typename Key, typename Value>
+    CompactAVLTree<Key, Value>::~CompactAVLTree() {
+        _clear(m_root);
+        m_size = 0;
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_COMPACT_AVL_TREE_IPP_
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../AVLTree/AVLTree.hpp"
+#include "../Benchmark/Benchmark.hpp"
+#include "CompactAVLTree.hpp"
+
+// Number of elements and of random lookups.
+static std::size_t g_elements = 10000000;
+static std::size_t g_lookups = 10000000;
+
+// Builds the tree from keys inserted in random order, then looks up random
+// keys and walks the whole tree in order. Both trees get the same keys.
+template <typename Tree>
+static void bench(const char* name, const std::vector<int>& keys, const std::vector<int>& probes) {
+    std::size_t baseBytes = g_liveBytes;
+    std::size_t baseBlocks = g_liveBlocks;
+
+    Tree* tree = new Tree();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        tree->insert(keys[i], keys[i]);
+    }
+    double insertMs = elapsed_ms(start);
+
+    std::size_t bytes = g_liveBytes - baseBytes;
+    std::size_t blocks = g_liveBlocks - baseBlocks;
+
+    start = std::chrono::steady_clock::now();
+    long long lookupSum = 0;
+    for (std::size_t i = 0; i < probes.size(); i++) {
+        lookupSum += tree->at(probes[i]);
+    }
+    double lookupMs = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    long long iterateSum = 0;
+    tree->for_each([&iterateSum](const int& key, const int& value) {
+        iterateSum += key + value;
+    });
+    double iterateMs = elapsed_ms(start);
+
+    std::cout << name << std::endl;
+    std::cout << "  heap:    " << static_cast<double>(bytes) / keys.size() << " bytes/element, "
+              << static_cast<double>(blocks) / keys.size() << " allocations/element" << std::endl;
+    std::cout << "  insert:  " << insertMs * 1e6 / keys.size() << " ns/op" << std::endl;
+    std::cout << "  lookup:  " << lookupMs * 1e6 / probes.size() << " ns/op" << std::endl;
+    std::cout << "  iterate: " << iterateMs * 1e6 / keys.size() << " ns/element" << std::endl;
+    std::cout << "  (checksums " << lookupSum << " " << iterateSum << ")" << std::endl;
+
+    delete tree;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_elements = std::strtoull(argv[1], nullptr, 10);
+    if (argc > 2) g_lookups = std::strtoull(argv[2], nullptr, 10);
+
+    std::cout << "elements: " << g_elements << " | lookups: " << g_lookups << std::endl;
+    std::cout << std::endl;
+
+    std::mt19937 rng(42);
+    std::vector<int> keys(g_elements);
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        keys[i] = static_cast<int>(i);
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    std::vector<int> probes(g_lookups);
+    for (std::size_t i = 0; i < probes.size(); i++) {
+        probes[i] = keys[rng() % keys.size()];
+    }
+
+    bench<DSA::AVLTree<int, int>>("AVLTree (pointer links, int height)", keys, probes);
+    std::cout << std::endl;
+    bench<DSA::CompactAVLTree<int, int>>("CompactAVLTree (32-bit index links, packed balance)", keys, probes);
+    return 0;
+}
@@ -18,17 +18,32 @@ namespace DSA {
         DequeNode<T>* m_tail;
         std::size_t m_size;
 
+        void _clear();
+
     public:
         Deque();
+        Deque(const Deque<T>& other);
+        Deque(Deque<T>&& other) noexcept;
+        Deque<T>& operator=(const Deque<T>& other);
+        Deque<T>& operator=(Deque<T>&& other) noexcept;
 
         void push_front(const T& value);
+        void push_front(T&& value);
         void push_back(const T& value);
+        void push_back(T&& value);
+        template <typename... Args>
+        void emplace_front(Args&&... args);
+        template <typename... Args>
+        void emplace_back(Args&&... args);
         void pop_front();
         void pop_back();
 
         const T& peek_front() const;
         const T& peek_back() const;
 
+        template <typename Callback>
+        void for_each(Callback callback) const;
+
         bool is_empty() const;
         std::size_t size() const;
 
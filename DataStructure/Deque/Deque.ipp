@@ -3,9 +3,23 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 #include "Deque.hpp"
 
 namespace DSA {
+    template <typename T>
+    void Deque<T>::_clear() {
+        DequeNode<T>* currentElement = m_head;
+        while (currentElement != nullptr) {
+            DequeNode<T>* nextElement = currentElement->next;
+            delete currentElement;
+            currentElement = nextElement;
+        }
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
+    }
+
     template <typename T>
     Deque<T>::Deque() {
         m_head = nullptr;
@@ -13,12 +27,82 @@ namespace DSA {
         m_size = 0;
     }
 
+    template <typename T>
+    Deque<T>::Deque(const Deque<T>& other) {
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
+
+        try {
+            for (DequeNode<T>* cursor = other.m_head; cursor != nullptr; cursor = cursor->next) {
+                push_back(cursor->data);
+            }
+        }
+        catch (...) {
+            _clear();
+            throw;
+        }
+    }
+
+    template <typename T>
+    Deque<T>::Deque(Deque<T>&& other) noexcept {
+        m_head = other.m_head;
+        m_tail = other.m_tail;
+        m_size = other.m_size;
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+
+    template <typename T>
+    Deque<T>& Deque<T>::operator=(const Deque<T>& other) {
+        if (this != &other) {
+            Deque<T> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    Deque<T>& Deque<T>::operator=(Deque<T>&& other) noexcept {
+        if (this != &other) {
+            _clear();
+            m_head = other.m_head;
+            m_tail = other.m_tail;
+            m_size = other.m_size;
+            other.m_head = nullptr;
+            other.m_tail = nullptr;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
     template <typename T>
     void Deque<T>::push_front(const T& value) {
-        DequeNode<T>* newElement = new DequeNode<T>();
-        newElement->data = value;
-        newElement->next = nullptr;
-        newElement->prev = nullptr;
+        emplace_front(value);
+    }
+
+    template <typename T>
+    void Deque<T>::push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename T>
+    void Deque<T>::push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    template <typename T>
+    void Deque<T>::push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void Deque<T>::emplace_front(Args&&... args) {
+        DequeNode<T>* newElement = new DequeNode<T>{T(std::forward<Args>(args)...), nullptr, nullptr};
 
         if (is_empty()) {
             m_head = newElement;
@@ -34,11 +118,9 @@ namespace DSA {
     }
 
     template <typename T>
-    void Deque<T>::push_back(const T& value) {
-        DequeNode<T>* newElement = new DequeNode<T>();
-        newElement->data = value;
-        newElement->next = nullptr;
-        newElement->prev = nullptr;
+    template <typename... Args>
+    void Deque<T>::emplace_back(Args&&... args) {
+        DequeNode<T>* newElement = new DequeNode<T>{T(std::forward<Args>(args)...), nullptr, nullptr};
 
         if (is_empty()) {
             m_head = newElement;
@@ -114,14 +196,17 @@ namespace DSA {
     }
 
     template <typename T>
-    Deque<T>::~Deque() {
-        DequeNode<T>* currentElement = m_head;
-        while (currentElement != nullptr) {
-            DequeNode<T>* nextElement = currentElement->next;
-            delete currentElement;
-            currentElement = nextElement;
+    template <typename Callback>
+    void Deque<T>::for_each(Callback callback) const {
+        for (DequeNode<T>* current = m_head; current != nullptr; current = current->next) {
+            callback(current->data);
         }
     }
+
+    template <typename T>
+    Deque<T>::~Deque() {
+        _clear();
+    }
 }
 
 #endif // CPPDSA_DATA_STRUCTURE_DEQUE_IPP_
\ No newline at end of file
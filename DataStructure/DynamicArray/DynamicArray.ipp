@@ -177,6 +177,7 @@ namespace DSA {
         delete[] m_buffer;
         m_buffer = new T[_DYNAMIC_ARRAY_INIT_SIZE];
         m_size = 0;
+        m_capacity = _DYNAMIC_ARRAY_INIT_SIZE;
     }
 
     template <typename T>
@@ -238,7 +239,7 @@ namespace DSA {
 
     template <typename T>
     inline T* DynamicArray<T>::data() {
-        return const_cast<T&>(static_cast<const DynamicArray<T>&>(*this).data());
+        return const_cast<T*>(static_cast<const DynamicArray<T>&>(*this).data());
     }
 
     template <typename T>
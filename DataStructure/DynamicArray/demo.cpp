@@ -152,7 +152,7 @@ int main() {
 
 
     array.clear();
-    std::cout << "Cleared the array via clear() (NOTE: capacity must remain the same)" << std::endl;
+    std::cout << "Cleared the array via clear() (NOTE: capacity goes back to the initial size)" << std::endl;
     std::cout << "Array size/cap: " << array.size() << " " << array.capacity() << std::endl;
     for (unsigned int i = 0; i < array.size(); i++) {
         std::cout << array[i] << " ";
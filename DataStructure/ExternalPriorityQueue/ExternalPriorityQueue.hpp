@@ -0,0 +1,131 @@
+#ifndef CPPDSA_DATA_STRUCTURE_EXTERNAL_PRIORITY_QUEUE_HPP_
+#define CPPDSA_DATA_STRUCTURE_EXTERNAL_PRIORITY_QUEUE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include "../DynamicArray/DynamicArray.hpp"
+#include "../PriorityQueue/PriorityQueue.hpp"
+
+namespace DSA {
+    // A priority queue that can hold more elements than fit in memory.
+    //
+    // New elements go into an in-memory binary heap. When that buffer is full
+    // it is sorted in place and written out as a sorted run on disk. Runs are
+    // written and read back one block at a time with plain sequential I/O,
+    // and a tournament tree over the first element of every run decides which
+    // run holds the next element. Pulling takes the better of the buffer's top
+    // and the tournament's winner, so inserts and pulls can be mixed freely.
+    //
+    // Half of the memory budget goes to the buffer and the rest to the runs,
+    // which caps the number of open runs. When that cap is reached,
+    // the smaller half of the runs is merged into one, so every element is
+    // rewritten only a logarithmic number of times. Each open run also needs
+    // about a kilobyte besides its block, so budgets below roughly ten
+    // kilobytes are rejected with std::invalid_argument.
+    //
+    // If writing a run fails, the insert that caused it throws and the queue
+    // keeps every element it held before. Should a failed merge also be unable
+    // to restore the runs it was reading, every later call throws.
+    //
+    // Elements are stored as raw bytes, so T has to be trivially copyable.
+    template <typename T>
+    class ExternalPriorityQueue {
+        static_assert(std::is_trivially_copyable<T>::value, "ExternalPriorityQueue needs a trivially copyable type.");
+
+    private:
+        static constexpr std::uint32_t _NONE = 0xFFFFFFFFu;
+        static constexpr std::size_t _MIN_BLOCK_BYTES = std::size_t(4) << 10;
+        static constexpr std::size_t _MAX_BLOCK_BYTES = std::size_t(1) << 20;
+        static constexpr std::size_t _DEFAULT_MEMORY_BUDGET = std::size_t(64) << 20;
+        // Memory an open run needs besides its block and file name: the Run
+        // itself, the C library's stream object, and its leaves and pointers
+        // in the tournaments.
+        static constexpr std::size_t _RUN_OVERHEAD_BYTES = 1024;
+
+        // A sorted run in a temporary file. While the run is being written the
+        // block collects elements; afterwards it holds the part of the file
+        // that is currently being read.
+        template <typename U>
+        struct Run {
+            std::FILE* file;
+            std::string path;
+            U* block;
+            std::size_t blockCount;
+            std::size_t blockPosition;
+            std::size_t length;
+            std::size_t unread;
+            std::size_t remaining;
+        };
+
+        // A winner tree: leaf i is run i, or _NONE once that run is used up,
+        // and every inner node holds the better of its two children.
+        template <typename U>
+        struct Tournament {
+            DynamicArray<Run<U>*> runs;
+            DynamicArray<std::uint32_t> winners;
+            std::size_t leaves;
+        };
+
+        DynamicArray<T> m_buffer;
+        Tournament<T> m_tournament;
+        std::size_t m_size;
+        int (*_compare)(const T& value1, const T& value2);
+
+        std::size_t m_bufferLimit;
+        std::size_t m_blockSize;
+        std::size_t m_maxRuns;
+        std::string m_directory;
+        std::string m_prefix;
+        std::size_t m_nextRunId;
+        bool m_failed;
+
+        Run<T>* _create_run();
+        void _write(Run<T>* run, const T& value);
+        void _finish_run(Run<T>* run);
+        void _refill(Run<T>* run);
+        void _advance(Run<T>* run);
+        void _rewind(Run<T>* run, const std::size_t remaining);
+        void _destroy_run(Run<T>* run);
+        void _check_usable() const;
+
+        std::uint32_t _winner(const Tournament<T>& tournament, const std::uint32_t run1, const std::uint32_t run2) const;
+        void _build(Tournament<T>& tournament);
+        void _replay(Tournament<T>& tournament, const std::uint32_t run);
+        bool _lower_priority(const T& value1, const T& value2) const;
+        bool _run_is_top() const;
+        void _pop_run_top();
+        void _pop_buffer_top();
+
+        void _spill();
+        void _compact();
+
+    public:
+        ExternalPriorityQueue(int (*comparator)(const T& value1, const T& value2) = max_queue,
+                              const std::size_t memoryBudget = _DEFAULT_MEMORY_BUDGET,
+                              const char* directory = nullptr);
+        ExternalPriorityQueue(const ExternalPriorityQueue<T>& other) = delete;
+        ExternalPriorityQueue<T>& operator=(const ExternalPriorityQueue<T>& other) = delete;
+
+        static int min_queue(const T& value1, const T& value2);
+        static int max_queue(const T& value1, const T& value2);
+
+        void insert(const T& value);
+        void pull();
+        bool pull(T& value);
+
+        const T& peek() const;
+
+        bool is_empty() const;
+        std::size_t size() const;
+        std::size_t run_count() const;
+
+        ~ExternalPriorityQueue();
+    };
+}
+
+#include "ExternalPriorityQueue.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_EXTERNAL_PRIORITY_QUEUE_HPP_
@@ -0,0 +1,442 @@
+#ifndef CPPDSA_DATA_STRUCTURE_EXTERNAL_PRIORITY_QUEUE_IPP_
+#define CPPDSA_DATA_STRUCTURE_EXTERNAL_PRIORITY_QUEUE_IPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include "../DynamicArray/DynamicArray.hpp"
+#include "../PriorityQueue/PriorityQueue.hpp"
+#include "ExternalPriorityQueue.hpp"
+
+namespace DSA {
+    template <typename T>
+    ExternalPriorityQueue<T>::Run<T>* ExternalPriorityQueue<T>::_create_run() {
+        Run<T>* run = new Run<T>{nullptr, m_directory + "/" + m_prefix + "-" + std::to_string(m_nextRunId++) + ".run",
+                                 nullptr, 0, 0, 0, 0, 0};
+        run->block = static_cast<T*>(::operator new(m_blockSize * sizeof(T)));
+        run->file = std::fopen(run->path.c_str(), "w+b");
+        if (run->file == nullptr) {
+            ::operator delete(run->block);
+            delete run;
+            throw std::runtime_error("Failed to create run file.");
+        }
+
+        // Reads and writes already go through the run's own block.
+        std::setvbuf(run->file, nullptr, _IONBF, 0);
+        return run;
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_write(Run<T>* run, const T& value) {
+        run->block[run->blockCount++] = value;
+        run->remaining++;
+
+        if (run->blockCount == m_blockSize) {
+            if (std::fwrite(run->block, sizeof(T), run->blockCount, run->file) != run->blockCount) {
+                throw std::runtime_error("Failed to write run file.");
+            }
+            run->blockCount = 0;
+        }
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_finish_run(Run<T>* run) {
+        if (std::fwrite(run->block, sizeof(T), run->blockCount, run->file) != run->blockCount
+            || std::fflush(run->file) != 0 || std::fseek(run->file, 0, SEEK_SET) != 0) {
+            throw std::runtime_error("Failed to write run file.");
+        }
+
+        run->length = run->remaining;
+        run->unread = run->remaining;
+        _refill(run);
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_refill(Run<T>* run) {
+        const std::size_t count = std::min(run->unread, m_blockSize);
+        if (std::fread(run->block, sizeof(T), count, run->file) != count) {
+            throw std::runtime_error("Failed to read run file.");
+        }
+
+        run->unread -= count;
+        run->blockCount = count;
+        run->blockPosition = 0;
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_advance(Run<T>* run) {
+        run->blockPosition++;
+        run->remaining--;
+        if (run->blockPosition == run->blockCount && run->unread > 0) {
+            _refill(run);
+        }
+    }
+
+    // Moves a finished run back to the point where `remaining` elements were
+    // still left to read.
+    //
+    // fseek only takes a long, which is 32 bits wide on some platforms, so
+    // the offset is reached from the start of the file in steps that fit.
+    template <typename T>
+    void ExternalPriorityQueue<T>::_rewind(Run<T>* run, const std::size_t remaining) {
+        std::size_t offset = (run->length - remaining) * sizeof(T);
+        bool positioned = std::fseek(run->file, 0, SEEK_SET) == 0;
+        while (positioned && offset > 0) {
+            const std::size_t step = std::min<std::size_t>(offset, std::numeric_limits<long>::max());
+            positioned = std::fseek(run->file, static_cast<long>(step), SEEK_CUR) == 0;
+            offset -= step;
+        }
+        if (!positioned) {
+            throw std::runtime_error("Failed to read run file.");
+        }
+
+        run->unread = remaining;
+        run->remaining = remaining;
+        _refill(run);
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_destroy_run(Run<T>* run) {
+        std::fclose(run->file);
+        std::remove(run->path.c_str());
+        ::operator delete(run->block);
+        delete run;
+    }
+
+    template <typename T>
+    inline void ExternalPriorityQueue<T>::_check_usable() const {
+        if (m_failed) {
+            throw std::runtime_error("Queue lost elements in a failed run merge.");
+        }
+    }
+
+    template <typename T>
+    std::uint32_t ExternalPriorityQueue<T>::_winner(const Tournament<T>& tournament, const std::uint32_t run1, const std::uint32_t run2) const {
+        if (run1 == _NONE) {
+            return run2;
+        }
+        if (run2 == _NONE) {
+            return run1;
+        }
+
+        const Run<T>* first = tournament.runs[run1];
+        const Run<T>* second = tournament.runs[run2];
+        return (_compare(first->block[first->blockPosition], second->block[second->blockPosition]) >= 0) ? run1 : run2;
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_build(Tournament<T>& tournament) {
+        tournament.leaves = 1;
+        while (tournament.leaves < tournament.runs.size()) {
+            tournament.leaves *= 2;
+        }
+
+        tournament.winners.resize(2 * tournament.leaves);
+        for (std::size_t i = 0; i < tournament.leaves; i++) {
+            const bool live = i < tournament.runs.size() && tournament.runs[i]->remaining > 0;
+            tournament.winners[tournament.leaves + i] = live ? static_cast<std::uint32_t>(i) : _NONE;
+        }
+        for (std::size_t i = tournament.leaves - 1; i > 0; i--) {
+            tournament.winners[i] = _winner(tournament, tournament.winners[2 * i], tournament.winners[2 * i + 1]);
+        }
+    }
+
+    // Only the matches on the path from the run's leaf to the root can change
+    // when the run moves on to its next element.
+    template <typename T>
+    void ExternalPriorityQueue<T>::_replay(Tournament<T>& tournament, const std::uint32_t run) {
+        std::size_t position = tournament.leaves + run;
+        tournament.winners[position] = (tournament.runs[run]->remaining > 0) ? run : _NONE;
+
+        for (position /= 2; position > 0; position /= 2) {
+            tournament.winners[position] = _winner(tournament, tournament.winners[2 * position], tournament.winners[2 * position + 1]);
+        }
+    }
+
+    template <typename T>
+    inline bool ExternalPriorityQueue<T>::_lower_priority(const T& value1, const T& value2) const {
+        return _compare(value1, value2) < 0;
+    }
+
+    template <typename T>
+    bool ExternalPriorityQueue<T>::_run_is_top() const {
+        const std::uint32_t top = m_tournament.winners[1];
+        if (top == _NONE) {
+            return false;
+        }
+        if (m_buffer.is_empty()) {
+            return true;
+        }
+
+        const Run<T>* run = m_tournament.runs[top];
+        return _compare(run->block[run->blockPosition], m_buffer.front()) > 0;
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_pop_run_top() {
+        const std::uint32_t top = m_tournament.winners[1];
+        Run<T>* run = m_tournament.runs[top];
+        _advance(run);
+
+        if (run->remaining > 0) {
+            _replay(m_tournament, top);
+        }
+        else {
+            _destroy_run(run);
+            m_tournament.runs[top] = m_tournament.runs.back();
+            m_tournament.runs.pop_back();
+            _build(m_tournament);
+        }
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::_pop_buffer_top() {
+        std::pop_heap(m_buffer.data(), m_buffer.data() + m_buffer.size(), [this](const T& value1, const T& value2) {
+            return _lower_priority(value1, value2);
+        });
+        m_buffer.pop_back();
+    }
+
+    // The buffer is a heap, which is also just an array, so it can be sorted
+    // directly. That is several times faster than pulling it apart one
+    // element at a time.
+    template <typename T>
+    void ExternalPriorityQueue<T>::_spill() {
+        std::sort(m_buffer.data(), m_buffer.data() + m_buffer.size(), [this](const T& value1, const T& value2) {
+            return _lower_priority(value2, value1);
+        });
+
+        // A buffer sorted from highest to lowest priority is still a valid
+        // heap, so if the run cannot be written the buffer is left as it is.
+        Run<T>* run = _create_run();
+        try {
+            for (std::size_t i = 0; i < m_buffer.size(); i++) {
+                _write(run, m_buffer[i]);
+            }
+            _finish_run(run);
+            m_tournament.runs.push_back(run);
+        }
+        catch (...) {
+            _destroy_run(run);
+            throw;
+        }
+
+        // Emptied element by element so that the buffer keeps its capacity.
+        while (!m_buffer.is_empty()) {
+            m_buffer.pop_back();
+        }
+
+        if (m_tournament.runs.size() > m_maxRuns) {
+            _compact();
+        }
+        else {
+            _build(m_tournament);
+        }
+    }
+
+    // Merges the smaller half of the runs into a single run. Always picking the
+    // smallest runs keeps runs of similar length together, like the levels of
+    // a multi-pass merge sort.
+    template <typename T>
+    void ExternalPriorityQueue<T>::_compact() {
+        DynamicArray<Run<T>*>& runs = m_tournament.runs;
+        for (std::size_t i = 1; i < runs.size(); i++) {
+            Run<T>* run = runs[i];
+            std::size_t j = i;
+            while (j > 0 && runs[j - 1]->remaining > run->remaining) {
+                runs[j] = runs[j - 1];
+                j--;
+            }
+            runs[j] = run;
+        }
+
+        const std::size_t count = std::max<std::size_t>(2, runs.size() / 2);
+        Tournament<T> merge;
+        DynamicArray<std::size_t> remaining;
+        for (std::size_t i = 0; i < count; i++) {
+            merge.runs.push_back(runs[i]);
+            remaining.push_back(runs[i]->remaining);
+        }
+        _build(merge);
+
+        Run<T>* output = _create_run();
+        try {
+            while (merge.winners[1] != _NONE) {
+                const std::uint32_t top = merge.winners[1];
+                Run<T>* run = merge.runs[top];
+                _write(output, run->block[run->blockPosition]);
+                _advance(run);
+                _replay(merge, top);
+            }
+            _finish_run(output);
+        }
+        catch (...) {
+            _destroy_run(output);
+
+            // Put the merged runs back where they were. If even that fails,
+            // the elements they had already given up cannot be recovered.
+            try {
+                for (std::size_t i = 0; i < count; i++) {
+                    _rewind(runs[i], remaining[i]);
+                }
+                _build(m_tournament);
+            }
+            catch (...) {
+                m_failed = true;
+            }
+            throw;
+        }
+
+        for (std::size_t i = 0; i < count; i++) {
+            _destroy_run(runs[i]);
+        }
+        runs.remove_at(0, count);
+        runs.push_back(output);
+        _build(m_tournament);
+    }
+
+    template <typename T>
+    ExternalPriorityQueue<T>::ExternalPriorityQueue(int (*comparator)(const T& value1, const T& value2),
+                                                    const std::size_t memoryBudget, const char* directory)
+{
+        _compare = comparator;
+        m_size = 0;
+
+        m_directory = (directory != nullptr) ? std::string(directory) : std::filesystem::temp_directory_path().string();
+        std::random_device random;
+        m_prefix = "dsa-epq-" + std::to_string(random()) + "-" + std::to_string(random());
+        m_nextRunId = 0;
+        m_failed = false;
+
+        // Every open run costs its block, its file name and _RUN_OVERHEAD_BYTES
+        // for everything else. A compaction has two more runs open than
+        // m_maxRuns: the run that was just spilled and the merge output. Small
+        // budgets get smaller blocks so that at least four runs fit, which
+        // leaves room for two runs to be merged.
+        const std::size_t bufferBytes = std::max(memoryBudget / 2, sizeof(T));
+        const std::size_t runBudget = memoryBudget - std::min(memoryBudget, bufferBytes);
+        const std::size_t pathBytes = m_directory.size() + m_prefix.size() + 32;
+        const std::size_t fixedRunBytes = 2 * pathBytes + _RUN_OVERHEAD_BYTES;
+        const std::size_t fitBytes = runBudget / 4 - std::min(runBudget / 4, fixedRunBytes);
+        if (fitBytes < sizeof(T)) {
+            throw std::invalid_argument("Memory budget is too small.");
+        }
+
+        const std::size_t blockBytes = std::min(std::clamp(memoryBudget / 64, _MIN_BLOCK_BYTES, _MAX_BLOCK_BYTES), fitBytes);
+        m_blockSize = blockBytes / sizeof(T);
+        m_maxRuns = runBudget / (m_blockSize * sizeof(T) + fixedRunBytes) - 2;
+        m_tournament.runs.reserve(m_maxRuns + 1);
+
+        // The buffer is reserved up front, since growing it by doubling would
+        // overshoot its half of the budget and briefly hold two copies.
+        m_bufferLimit = bufferBytes / sizeof(T);
+        m_buffer.reserve(m_bufferLimit);
+
+        _build(m_tournament);
+    }
+
+    template <typename T>
+    int ExternalPriorityQueue<T>::min_queue(const T& value1, const T& value2) {
+        return PriorityQueue<T>::min_queue(value1, value2);
+    }
+
+    template <typename T>
+    int ExternalPriorityQueue<T>::max_queue(const T& value1, const T& value2) {
+        return PriorityQueue<T>::max_queue(value1, value2);
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::insert(const T& value) {
+        _check_usable();
+        if (m_buffer.size() >= m_bufferLimit) {
+            _spill();
+        }
+
+        m_buffer.push_back(value);
+        std::push_heap(m_buffer.data(), m_buffer.data() + m_buffer.size(), [this](const T& value1, const T& value2) {
+            return _lower_priority(value1, value2);
+        });
+        m_size++;
+    }
+
+    template <typename T>
+    void ExternalPriorityQueue<T>::pull() {
+        _check_usable();
+        if (is_empty()) {
+            throw std::underflow_error("Queue is empty.");
+        }
+
+        if (_run_is_top()) {
+            _pop_run_top();
+        }
+        else {
+            _pop_buffer_top();
+        }
+        m_size--;
+    }
+
+    template <typename T>
+    bool ExternalPriorityQueue<T>::pull(T& value) {
+        _check_usable();
+        if (is_empty()) {
+            return false;
+        }
+
+        if (_run_is_top()) {
+            const Run<T>* run = m_tournament.runs[m_tournament.winners[1]];
+            value = run->block[run->blockPosition];
+            _pop_run_top();
+        }
+        else {
+            value = m_buffer.front();
+            _pop_buffer_top();
+        }
+        m_size--;
+        return true;
+    }
+
+    template <typename T>
+    const T& ExternalPriorityQueue<T>::peek() const {
+        _check_usable();
+        if (is_empty()) {
+            throw std::out_of_range("Queue is empty.");
+        }
+
+        if (_run_is_top()) {
+            const Run<T>* run = m_tournament.runs[m_tournament.winners[1]];
+            return run->block[run->blockPosition];
+        }
+        return m_buffer.front();
+    }
+
+    template <typename T>
+    inline bool ExternalPriorityQueue<T>::is_empty() const {
+        return m_size == 0;
+    }
+
+    template <typename T>
+    inline std::size_t ExternalPriorityQueue<T>::size() const {
+        return m_size;
+    }
+
+    template <typename T>
+    inline std::size_t ExternalPriorityQueue<T>::run_count() const {
+        return m_tournament.runs.size();
+    }
+
+    template <typename T>
+    ExternalPriorityQueue<T>::~ExternalPriorityQueue() {
+        for (std::size_t i = 0; i < m_tournament.runs.size(); i++) {
+            _destroy_run(m_tournament.runs[i]);
+        }
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_EXTERNAL_PRIORITY_QUEUE_IPP_
@@ -0,0 +1,25 @@
+#ifndef CPPDSA_DATA_STRUCTURE_EXTERNAL_SORT_HPP_
+#define CPPDSA_DATA_STRUCTURE_EXTERNAL_SORT_HPP_
+
+#include <cstddef>
+#include "ExternalPriorityQueue.hpp"
+
+namespace DSA {
+    // Sorts a file of fixed-size binary records of type T that may be larger
+    // than memory, writing the result to another file. The records are pushed
+    // through an ExternalPriorityQueue, which forms the sorted runs and merges
+    // them, and pulled out in order. With the default comparator the output is
+    // in ascending order. Input and output may be the same file.
+    //
+    // Returns the number of records sorted. Throws std::invalid_argument if
+    // the memory budget is too small for the queue.
+    template <typename T>
+    std::size_t external_sort(const char* inputPath, const char* outputPath,
+                              int (*comparator)(const T& value1, const T& value2) = ExternalPriorityQueue<T>::min_queue,
+                              const std::size_t memoryBudget = std::size_t(64) << 20,
+                              const char* directory = nullptr);
+}
+
+#include "ExternalSort.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_EXTERNAL_SORT_HPP_
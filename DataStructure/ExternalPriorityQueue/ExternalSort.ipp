@@ -0,0 +1,78 @@
+#ifndef CPPDSA_DATA_STRUCTURE_EXTERNAL_SORT_IPP_
+#define CPPDSA_DATA_STRUCTURE_EXTERNAL_SORT_IPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include "../DynamicArray/DynamicArray.hpp"
+#include "ExternalPriorityQueue.hpp"
+#include "ExternalSort.hpp"
+
+namespace DSA {
+    template <typename T>
+    std::size_t external_sort(const char* inputPath, const char* outputPath,
+                              int (*comparator)(const T& value1, const T& value2),
+                              const std::size_t memoryBudget, const char* directory) {
+        if (std::filesystem::file_size(inputPath) % sizeof(T) != 0) {
+            throw std::runtime_error("Input size is not a multiple of the record size.");
+        }
+
+        // One block is used for reading the input and later for writing the
+        // output; the queue gets the rest of the budget.
+        const std::size_t blockBytes = std::min(memoryBudget / 64, std::size_t(1) << 20);
+        const std::size_t blockSize = std::max<std::size_t>(1, blockBytes / sizeof(T));
+        DynamicArray<T> block;
+        block.resize(blockSize);
+
+        const std::size_t queueBudget = std::max(memoryBudget, 2 * blockSize * sizeof(T)) - blockSize * sizeof(T);
+        ExternalPriorityQueue<T> queue(comparator, queueBudget, directory);
+
+        std::FILE* input = std::fopen(inputPath, "rb");
+        if (input == nullptr) {
+            throw std::runtime_error("Failed to open input file.");
+        }
+        std::setvbuf(input, nullptr, _IONBF, 0);
+
+        std::size_t count;
+        do {
+            count = std::fread(block.data(), sizeof(T), blockSize, input);
+            for (std::size_t i = 0; i < count; i++) {
+                queue.insert(block[i]);
+            }
+        } while (count == blockSize);
+
+        const bool failed = std::ferror(input) != 0;
+        std::fclose(input);
+        if (failed) {
+            throw std::runtime_error("Failed to read input file.");
+        }
+
+        std::FILE* output = std::fopen(outputPath, "wb");
+        if (output == nullptr) {
+            throw std::runtime_error("Failed to open output file.");
+        }
+        std::setvbuf(output, nullptr, _IONBF, 0);
+
+        const std::size_t records = queue.size();
+        count = 0;
+        while (queue.pull(block[count])) {
+            count++;
+            if (count == blockSize || queue.is_empty()) {
+                if (std::fwrite(block.data(), sizeof(T), count, output) != count) {
+                    std::fclose(output);
+                    throw std::runtime_error("Failed to write output file.");
+                }
+                count = 0;
+            }
+        }
+
+        if (std::fclose(output) != 0) {
+            throw std::runtime_error("Failed to write output file.");
+        }
+        return records;
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_EXTERNAL_SORT_IPP_
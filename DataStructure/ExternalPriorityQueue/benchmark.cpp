@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Benchmark/Timer.hpp"
+#include "ExternalSort.hpp"
+
+// Generates a file of random fixed-size records, sorts it with external_sort
+// under the given memory budget, and streams the result back to check that it
+// is in order. Sizes are given on the command line:
+//
+//   benchmark [file size in GiB] [memory budget in MiB] [directory]
+
+struct Record {
+    std::uint64_t key;
+    std::uint64_t payload;
+};
+
+static int by_key(const Record& record1, const Record& record2) {
+    if (record1.key < record2.key) {
+        return 1;
+    }
+    else if (record1.key > record2.key) {
+        return -1;
+    }
+    else {
+        return 0;
+    }
+}
+
+static double g_fileGiB = 20;
+static std::size_t g_budgetMiB = 1024;
+static std::string g_directory;
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_fileGiB = std::strtod(argv[1], nullptr);
+    if (argc > 2) g_budgetMiB = std::strtoull(argv[2], nullptr, 10);
+    g_directory = (argc > 3) ? std::string(argv[3]) : std::filesystem::temp_directory_path().string();
+
+    const std::size_t records = static_cast<std::size_t>(g_fileGiB * (1ull << 30)) / sizeof(Record);
+    const double mib = static_cast<double>(records * sizeof(Record)) / (1 << 20);
+    const std::string inputPath = g_directory + "/dsa-sort-input.bin";
+    const std::string outputPath = g_directory + "/dsa-sort-output.bin";
+
+    std::cout << "records: " << records << " (" << mib / 1024 << " GiB) | memory budget: " << g_budgetMiB
+              << " MiB | directory: " << g_directory << std::endl;
+    std::cout << std::endl;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::FILE* file = std::fopen(inputPath.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "cannot create " << inputPath << std::endl;
+        return 1;
+    }
+    std::mt19937_64 rng(42);
+    std::vector<Record> block(1 << 16);
+    for (std::size_t written = 0; written < records; written += block.size()) {
+        const std::size_t count = std::min(block.size(), records - written);
+        for (std::size_t i = 0; i < count; i++) {
+            block[i].key = rng();
+            block[i].payload = written + i;
+        }
+        std::fwrite(block.data(), sizeof(Record), count, file);
+    }
+    std::fclose(file);
+    double seconds = elapsed_s(start);
+    std::cout << "generate: " << seconds << " s | " << mib / seconds << " MiB/s" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    DSA::external_sort<Record>(inputPath.c_str(), outputPath.c_str(), by_key, g_budgetMiB << 20, g_directory.c_str());
+    seconds = elapsed_s(start);
+    std::cout << "sort:     " << seconds << " s | " << mib / seconds << " MiB/s" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    file = std::fopen(outputPath.c_str(), "rb");
+    std::size_t checked = 0;
+    bool sorted = true;
+    std::uint64_t previous = 0;
+    std::size_t count;
+    while ((count = std::fread(block.data(), sizeof(Record), block.size(), file)) > 0) {
+        for (std::size_t i = 0; i < count; i++) {
+            sorted = sorted && block[i].key >= previous;
+            previous = block[i].key;
+        }
+        checked += count;
+    }
+    std::fclose(file);
+    seconds = elapsed_s(start);
+    std::cout << "verify:   " << seconds << " s | " << mib / seconds << " MiB/s | "
+              << ((sorted && checked == records) ? "sorted" : "NOT SORTED") << std::endl;
+
+    std::remove(inputPath.c_str());
+    std::remove(outputPath.c_str());
+    return (sorted && checked == records) ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include "ExternalPriorityQueue.hpp"
+#include "ExternalSort.hpp"
+
+int main() {
+    // A small memory budget so that a few thousand elements already spill to disk.
+    DSA::ExternalPriorityQueue<int> pq(DSA::ExternalPriorityQueue<int>::min_queue, 16 << 10);
+    std::cout << "External Priority Queue is initialized with a 16 KiB budget" << std::endl;
+    std::cout << "PQ Size: " << pq.size() << " | Runs: " << pq.run_count() << std::endl << std::endl;
+
+    for (int i = 0; i < 10000; i++) {
+        pq.insert(i * 7919 % 10000);
+    }
+    std::cout << "The numbers 0 to 9999 are inserted in a scrambled order via insert()" << std::endl;
+    std::cout << "PQ Size: " << pq.size() << " | Runs: " << pq.run_count() << " | Top: " << pq.peek() << std::endl << std::endl;
+
+    pq.pull();
+    pq.pull();
+    std::cout << "Two elements are pulled from the PQ via pull()" << std::endl;
+    std::cout << "PQ Size: " << pq.size() << " | Runs: " << pq.run_count() << " | Top: " << pq.peek() << std::endl << std::endl;
+
+    pq.insert(-1);
+    std::cout << "-1 is inserted to PQ via insert()" << std::endl;
+    std::cout << "PQ Size: " << pq.size() << " | Runs: " << pq.run_count() << " | Top: " << pq.peek() << std::endl << std::endl;
+
+    std::cout << "Streaming the ten smallest out via pull(value)" << std::endl;
+    std::cout << "EXPECT: -1 2 3 4 5 6 7 8 9 10" << std::endl;
+    int value;
+    for (int i = 0; i < 10 && pq.pull(value); i++) {
+        std::cout << value << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "PQ Size: " << pq.size() << " | Runs: " << pq.run_count() << std::endl << std::endl;
+
+    std::cout << "Streaming the rest out via pull(value)" << std::endl;
+    std::cout << "EXPECT: 9989 elements from 11 to 9999 in order" << std::endl;
+    std::size_t streamed = 0;
+    int first = 0;
+    bool ordered = true;
+    int previous = 10;
+    while (pq.pull(value)) {
+        if (streamed == 0) {
+            first = value;
+        }
+        ordered = ordered && value > previous;
+        previous = value;
+        streamed++;
+    }
+    std::cout << streamed << " elements from " << first << " to " << previous << (ordered ? " in order" : " out of order") << std::endl;
+    std::cout << "PQ Size: " << pq.size() << " | Runs: " << pq.run_count() << std::endl << std::endl;
+
+    int values[] = {42, 7, 19, 3, 88, 25, 61, 14, 9, 70, 33, 50};
+    std::string path = (std::filesystem::temp_directory_path() / "dsa-external-sort-demo.bin").string();
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    std::fwrite(values, sizeof(int), sizeof(values) / sizeof(int), file);
+    std::fclose(file);
+
+    std::size_t sorted = DSA::external_sort<int>(path.c_str(), path.c_str(), DSA::ExternalPriorityQueue<int>::min_queue, 16 << 10);
+    std::cout << sorted << " records are sorted in place via external_sort()" << std::endl;
+    std::cout << "EXPECT: 3 7 9 14 19 25 33 42 50 61 70 88" << std::endl;
+    file = std::fopen(path.c_str(), "rb");
+    while (std::fread(&value, sizeof(int), 1, file) == 1) {
+        std::cout << value << " ";
+    }
+    std::cout << std::endl;
+    std::fclose(file);
+    std::remove(path.c_str());
+    return 0;
+}
@@ -19,15 +19,29 @@ namespace DSA {
         LinkedListNode<T>* m_tail;
         std::size_t m_size;
         LinkedListNode<T>* _get_reference(const std::size_t index);
+        void _clear();
 
     public:
         LinkedList();
+        LinkedList(const LinkedList<T>& other);
+        LinkedList(LinkedList<T>&& other) noexcept;
+        LinkedList<T>& operator=(const LinkedList<T>& other);
+        LinkedList<T>& operator=(LinkedList<T>&& other) noexcept;
 
         void push_front(const T& value);
+        void push_front(T&& value);
         void push_back(const T& value);
+        void push_back(T&& value);
+        template <typename... Args>
+        void emplace_front(Args&&... args);
+        template <typename... Args>
+        void emplace_back(Args&&... args);
         void pop_front();
         void pop_back();
         void insert_at(const std::size_t index, const T& value);
+        void insert_at(const std::size_t index, T&& value);
+        template <typename... Args>
+        void emplace_at(const std::size_t index, Args&&... args);
         void remove_at(const std::size_t index);
 
         const T& peek_front() const;
@@ -38,6 +52,9 @@ namespace DSA {
 
         T& operator[](const std::size_t index);
 
+        template <typename Callback>
+        void for_each(Callback callback) const;
+
         ~LinkedList();
     };
 }
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 #include "LinkedList.hpp"
 
 namespace DSA {
@@ -30,6 +31,17 @@ namespace DSA {
         return cursor;
     }
 
+    template <typename T>
+    void LinkedList<T>::_clear() {
+        while (!is_empty()) {
+            LinkedListNode<T>* headElement = m_head;
+            m_head = m_head->next;
+            delete headElement;
+            m_size--;
+        }
+        m_tail = nullptr;
+    }
+
     template <typename T>
     LinkedList<T>::LinkedList() {
         m_head = nullptr;
@@ -37,12 +49,82 @@ namespace DSA {
         m_size = 0;
     }
 
+    template <typename T>
+    LinkedList<T>::LinkedList(const LinkedList<T>& other) {
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
+
+        try {
+            for (LinkedListNode<T>* cursor = other.m_head; cursor != nullptr; cursor = cursor->next) {
+                push_back(cursor->data);
+            }
+        }
+        catch (...) {
+            _clear();
+            throw;
+        }
+    }
+
+    template <typename T>
+    LinkedList<T>::LinkedList(LinkedList<T>&& other) noexcept {
+        m_head = other.m_head;
+        m_tail = other.m_tail;
+        m_size = other.m_size;
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+
+    template <typename T>
+    LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T>& other) {
+        if (this != &other) {
+            LinkedList<T> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    LinkedList<T>& LinkedList<T>::operator=(LinkedList<T>&& other) noexcept {
+        if (this != &other) {
+            _clear();
+            m_head = other.m_head;
+            m_tail = other.m_tail;
+            m_size = other.m_size;
+            other.m_head = nullptr;
+            other.m_tail = nullptr;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
     template <typename T>
     void LinkedList<T>::push_front(const T& value) {
-        LinkedListNode<T>* newElement = new LinkedListNode<T>();
-        newElement->data = value;
-        newElement->next = nullptr;
-        newElement->prev = nullptr;
+        emplace_front(value);
+    }
+
+    template <typename T>
+    void LinkedList<T>::push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename T>
+    void LinkedList<T>::push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    template <typename T>
+    void LinkedList<T>::push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void LinkedList<T>::emplace_front(Args&&... args) {
+        LinkedListNode<T>* newElement = new LinkedListNode<T>{T(std::forward<Args>(args)...), nullptr, nullptr};
 
         if (is_empty()) {
             m_head = newElement;
@@ -58,11 +140,9 @@ namespace DSA {
     }    
 
     template <typename T>
-    void LinkedList<T>::push_back(const T& value) {
-        LinkedListNode<T>* newElement = new LinkedListNode<T>();
-        newElement->data = value;
-        newElement->next = nullptr;
-        newElement->prev = nullptr;
+    template <typename... Args>
+    void LinkedList<T>::emplace_back(Args&&... args) {
+        LinkedListNode<T>* newElement = new LinkedListNode<T>{T(std::forward<Args>(args)...), nullptr, nullptr};
 
         if (is_empty()) {
             m_head = newElement;
@@ -117,20 +197,28 @@ namespace DSA {
 
     template <typename T>
     void LinkedList<T>::insert_at(const std::size_t index, const T& value) {
+        emplace_at(index, value);
+    }
+
+    template <typename T>
+    void LinkedList<T>::insert_at(const std::size_t index, T&& value) {
+        emplace_at(index, std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void LinkedList<T>::emplace_at(const std::size_t index, Args&&... args) {
         if (index == 0) {
-            push_front(value);
+            emplace_front(std::forward<Args>(args)...);
         }
         else if (index == m_size) {
-            push_back(value);
+            emplace_back(std::forward<Args>(args)...);
         }
         else {
             LinkedListNode<T>* proceedingElement = _get_reference(index);
             LinkedListNode<T>* preceedingElement = proceedingElement->prev;
 
-            LinkedListNode<T>* newElement = new LinkedListNode<T>();
-            newElement->data = value;
-            newElement->next = proceedingElement;
-            newElement->prev = preceedingElement;
+            LinkedListNode<T>* newElement = new LinkedListNode<T>{T(std::forward<Args>(args)...), proceedingElement, preceedingElement};
             
             preceedingElement->next = newElement;
             proceedingElement->prev = newElement;
@@ -190,15 +278,18 @@ namespace DSA {
     }
 
     template <typename T>
-    LinkedList<T>::~LinkedList() {
-        while (!is_empty()) {
-            LinkedListNode<T>* headElement = m_head;
-            m_head = m_head->next;
-            delete headElement;
-            m_size--;
+    template <typename Callback>
+    void LinkedList<T>::for_each(Callback callback) const {
+        for (LinkedListNode<T>* current = m_head; current != nullptr; current = current->next) {
+            callback(current->data);
         }
     }
 
+    template <typename T>
+    LinkedList<T>::~LinkedList() {
+        _clear();
+    }
+
 }
 
 #endif // CPPDSA_DATA_STRUCTURE_LINKED_LIST_IPP_
\ No newline at end of file
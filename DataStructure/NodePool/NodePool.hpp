@@ -0,0 +1,69 @@
+#ifndef CPPDSA_DATA_STRUCTURE_NODE_POOL_HPP_
+#define CPPDSA_DATA_STRUCTURE_NODE_POOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace DSA {
+    // An arena for the nodes of a linked structure. Nodes are stored side by
+    // side in fixed-size chunks and referred to by 32-bit indices instead of
+    // pointers, which halves the size of every link and removes the
+    // per-allocation header of the general-purpose allocator. Freed slots are
+    // kept in a free list and reused before a new chunk is allocated. Growing
+    // the pool never moves a node.
+    //
+    // The pool does not know which slots are in use, so the owner has to
+    // destroy every live node before the pool itself is destroyed.
+    template <typename T>
+    class NodePool {
+    public:
+        static constexpr std::uint32_t NIL = 0xFFFFFFFFu;
+
+    private:
+        static constexpr std::size_t _CHUNK_BITS = 12;
+        static constexpr std::size_t _CHUNK_SIZE = std::size_t(1) << _CHUNK_BITS;
+
+        template <typename U>
+        union PoolSlot {
+            U value;
+            std::uint32_t nextFree;
+
+            PoolSlot() {}
+            ~PoolSlot() {}
+        };
+
+        // The chunk table is a plain owning array rather than a DynamicArray
+        // so that moving a pool is a matter of swapping a few words.
+        PoolSlot<T>** m_chunks;
+        std::size_t m_chunkCount;
+        std::size_t m_chunkCapacity;
+        std::uint32_t m_freeHead;
+        std::size_t m_size;
+        std::size_t m_limit;
+
+        void _swap(NodePool<T>& other) noexcept;
+
+    public:
+        NodePool(const std::size_t limit = NIL);
+        NodePool(const NodePool<T>& other) = delete;
+        NodePool(NodePool<T>&& other) noexcept;
+        NodePool<T>& operator=(const NodePool<T>& other) = delete;
+        NodePool<T>& operator=(NodePool<T>&& other) noexcept;
+
+        template <typename... Args>
+        std::uint32_t create(Args&&... args);
+        void destroy(const std::uint32_t index);
+
+        T& operator[](const std::uint32_t index);
+        const T& operator[](const std::uint32_t index) const;
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+
+        ~NodePool();
+    };
+}
+
+#include "NodePool.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_NODE_POOL_HPP_
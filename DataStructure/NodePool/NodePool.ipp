@@ -0,0 +1,144 @@
+#ifndef CPPDSA_DATA_STRUCTURE_NODE_POOL_IPP_
+#define CPPDSA_DATA_STRUCTURE_NODE_POOL_IPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "NodePool.hpp"
+
+namespace DSA {
+    template <typename T>
+    void NodePool<T>::_swap(NodePool<T>& other) noexcept {
+        std::swap(m_chunks, other.m_chunks);
+        std::swap(m_chunkCount, other.m_chunkCount);
+        std::swap(m_chunkCapacity, other.m_chunkCapacity);
+        std::swap(m_freeHead, other.m_freeHead);
+        std::swap(m_size, other.m_size);
+        std::swap(m_limit, other.m_limit);
+    }
+
+    template <typename T>
+    NodePool<T>::NodePool(const std::size_t limit) {
+        m_chunks = nullptr;
+        m_chunkCount = 0;
+        m_chunkCapacity = 0;
+        m_freeHead = NIL;
+        m_size = 0;
+        m_limit = (limit < NIL) ? limit : NIL;
+    }
+
+    template <typename T>
+    NodePool<T>::NodePool(NodePool<T>&& other) noexcept {
+        m_chunks = other.m_chunks;
+        m_chunkCount = other.m_chunkCount;
+        m_chunkCapacity = other.m_chunkCapacity;
+        m_freeHead = other.m_freeHead;
+        m_size = other.m_size;
+        m_limit = other.m_limit;
+
+        other.m_chunks = nullptr;
+        other.m_chunkCount = 0;
+        other.m_chunkCapacity = 0;
+        other.m_freeHead = NIL;
+        other.m_size = 0;
+    }
+
+    // The chunks of this pool go to `other`, which releases them when it is destroyed.
+    template <typename T>
+    NodePool<T>& NodePool<T>::operator=(NodePool<T>&& other) noexcept {
+        if (this != &other) {
+            _swap(other);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    std::uint32_t NodePool<T>::create(Args&&... args) {
+        if (m_freeHead == NIL) {
+            const std::size_t base = m_chunkCount * _CHUNK_SIZE;
+            if (base >= m_limit) {
+                throw std::length_error("Node pool is full.");
+            }
+
+            if (m_chunkCount == m_chunkCapacity) {
+                const std::size_t capacity = (m_chunkCapacity == 0) ? 8 : m_chunkCapacity * 2;
+                PoolSlot<T>** chunks = new PoolSlot<T>*[capacity];
+                for (std::size_t i = 0; i < m_chunkCount; i++) {
+                    chunks[i] = m_chunks[i];
+                }
+                delete[] m_chunks;
+                m_chunks = chunks;
+                m_chunkCapacity = capacity;
+            }
+
+            PoolSlot<T>* chunk = new PoolSlot<T>[_CHUNK_SIZE];
+            for (std::size_t i = 0; i < _CHUNK_SIZE; i++) {
+                const std::size_t next = base + i + 1;
+                chunk[i].nextFree = (i + 1 < _CHUNK_SIZE && next < m_limit) ? static_cast<std::uint32_t>(next) : NIL;
+            }
+
+            m_chunks[m_chunkCount++] = chunk;
+            m_freeHead = static_cast<std::uint32_t>(base);
+        }
+
+        const std::uint32_t index = m_freeHead;
+        PoolSlot<T>& slot = m_chunks[index >> _CHUNK_BITS][index & (_CHUNK_SIZE - 1)];
+        const std::uint32_t nextFree = slot.nextFree;
+
+        // Node structs are usually aggregates, which cannot be initialized
+        // with parentheses before C++20.
+        if constexpr (std::is_aggregate_v<T>) {
+            new (&slot.value) T{std::forward<Args>(args)...};
+        }
+        else {
+            new (&slot.value) T(std::forward<Args>(args)...);
+        }
+        m_freeHead = nextFree;
+        m_size++;
+        return index;
+    }
+
+    template <typename T>
+    void NodePool<T>::destroy(const std::uint32_t index) {
+        PoolSlot<T>& slot = m_chunks[index >> _CHUNK_BITS][index & (_CHUNK_SIZE - 1)];
+        slot.value.~T();
+        slot.nextFree = m_freeHead;
+        m_freeHead = index;
+        m_size--;
+    }
+
+    template <typename T>
+    inline T& NodePool<T>::operator[](const std::uint32_t index) {
+        return m_chunks[index >> _CHUNK_BITS][index & (_CHUNK_SIZE - 1)].value;
+    }
+
+    template <typename T>
+    inline const T& NodePool<T>::operator[](const std::uint32_t index) const {
+        return m_chunks[index >> _CHUNK_BITS][index & (_CHUNK_SIZE - 1)].value;
+    }
+
+    template <typename T>
+    inline std::size_t NodePool<T>::size() const {
+        return m_size;
+    }
+
+    template <typename T>
+    inline std::size_t NodePool<T>::capacity() const {
+        return m_chunkCount * _CHUNK_SIZE;
+    }
+
+    template <typename T>
+    NodePool<T>::~NodePool() {
+        for (std::size_t i = 0; i < m_chunkCount; i++) {
+            delete[] m_chunks[i];
+        }
+        delete[] m_chunks;
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_NODE_POOL_IPP_
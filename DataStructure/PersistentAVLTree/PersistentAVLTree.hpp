@@ -0,0 +1,80 @@
+#ifndef CPPDSA_DATA_STRUCTURE_PERSISTENT_AVL_TREE_HPP_
+#define CPPDSA_DATA_STRUCTURE_PERSISTENT_AVL_TREE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+
+namespace DSA {
+    // An AVL tree whose versions share structure. Nodes are never modified once
+    // they are reachable: insert() and remove() copy only the nodes on the path
+    // from the root to the affected key, and every other subtree is shared with
+    // the previous version through a reference count. Taking a snapshot is
+    // therefore just another reference to the current root.
+    template <typename Key, typename Value>
+    class PersistentAVLTree {
+    private:
+        template <typename _Key, typename _Value>
+        struct PersistentAVLNode {
+            _Key key;
+            _Value data;
+            PersistentAVLNode<_Key, _Value>* left;
+            PersistentAVLNode<_Key, _Value>* right;
+            int height;
+            // Number of parents (or tree roots) pointing at this node. Atomic so
+            // that snapshots can be released from a different thread than the
+            // one updating the tree.
+            std::atomic<std::size_t> refcount;
+        };
+
+        PersistentAVLNode<Key, Value>* m_root;
+        std::size_t m_size;
+        int (*_compare)(const Key& key1, const Key& key2);
+
+        static int _default_compare(const Key& key1, const Key& key2);
+
+        static PersistentAVLNode<Key, Value>* _retain(PersistentAVLNode<Key, Value>* node);
+        static void _release(PersistentAVLNode<Key, Value>* node);
+
+        static int _height(const PersistentAVLNode<Key, Value>* node);
+        static PersistentAVLNode<Key, Value>* _make_node(const Key& key, const Value& value, PersistentAVLNode<Key, Value>* left, PersistentAVLNode<Key, Value>* right);
+        static PersistentAVLNode<Key, Value>* _balance(const Key& key, const Value& value, PersistentAVLNode<Key, Value>* left, PersistentAVLNode<Key, Value>* right);
+
+        PersistentAVLNode<Key, Value>* _insert(const PersistentAVLNode<Key, Value>* root, const Key& key, const Value& value) const;
+        PersistentAVLNode<Key, Value>* _remove(const PersistentAVLNode<Key, Value>* root, const Key& key) const;
+        static PersistentAVLNode<Key, Value>* _remove_min(const PersistentAVLNode<Key, Value>* root);
+
+        void _preorder(const PersistentAVLNode<Key, Value>* root, std::ostringstream& outstring) const;
+        void _inorder(const PersistentAVLNode<Key, Value>* root, std::ostringstream& outstring) const;
+        void _postorder(const PersistentAVLNode<Key, Value>* root, std::ostringstream& outstring) const;
+
+    public:
+        PersistentAVLTree(int (*comparator)(const Key& key1, const Key& key2) = _default_compare);
+        PersistentAVLTree(const PersistentAVLTree<Key, Value>& other);
+        PersistentAVLTree<Key, Value>& operator=(const PersistentAVLTree<Key, Value>& other);
+
+        void insert(const Key& key, const Value& value);
+        void remove(const Key& key);
+
+        PersistentAVLTree<Key, Value> snapshot() const;
+
+        bool is_empty() const;
+        std::size_t size() const;
+
+        const Value& min() const;
+        const Value& max() const;
+
+        bool contains(const Key& key) const;
+        const Value& at(const Key& key) const;
+
+        std::string preorder() const;
+        std::string inorder() const;
+        std::string postorder() const;
+
+        ~PersistentAVLTree();
+    };
+}
+
+#include "PersistentAVLTree.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_PERSISTENT_AVL_TREE_HPP_
@@ -0,0 +1,355 @@
+#ifndef CPPDSA_DATA_STRUCTURE_PERSISTENT_AVL_TREE_IPP_
+#define CPPDSA_DATA_STRUCTURE_PERSISTENT_AVL_TREE_IPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <sstream>
+#include "PersistentAVLTree.hpp"
+
+namespace DSA {
+    template <typename Key, typename Value>
+    int PersistentAVLTree<Key, Value>::_default_compare(const Key& key1, const Key& key2) {
+        if (key1 > key2) {
+            return 1;
+        }
+        else if (key1 < key2) {
+            return -1;
+        }
+        else {
+            return 0;
+        }
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLNode<Key, Value>* PersistentAVLTree<Key, Value>::_retain(PersistentAVLNode<Key, Value>* node) {
+        if (node != nullptr) {
+            node->refcount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return node;
+    }
+
+    template <typename Key, typename Value>
+    void PersistentAVLTree<Key, Value>::_release(PersistentAVLNode<Key, Value>* node) {
+        // Only the last owner tears the node down, so the recursion never goes
+        // deeper than the height of the tree.
+        if (node != nullptr && node->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            _release(node->left);
+            _release(node->right);
+            delete node;
+        }
+    }
+
+    template <typename Key, typename Value>
+    int PersistentAVLTree<Key, Value>::_height(const PersistentAVLNode<Key, Value>* node) {
+        if (node == nullptr) {
+            return -1;
+        }
+
+        return node->height;
+    }
+
+    // Takes over the references held by left and right and returns a node with
+    // a single reference owned by the caller.
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLNode<Key, Value>* PersistentAVLTree<Key, Value>::_make_node(const Key& key, const Value& value, PersistentAVLNode<Key, Value>* left, PersistentAVLNode<Key, Value>* right) {
+        PersistentAVLNode<Key, Value>* newNode = new PersistentAVLNode<Key, Value>();
+        newNode->key = key;
+        newNode->data = value;
+        newNode->left = left;
+        newNode->right = right;
+        newNode->height = std::max(_height(left), _height(right)) + 1;
+        newNode->refcount.store(1, std::memory_order_relaxed);
+        return newNode;
+    }
+
+    // Builds the node {key, value} over the given subtrees, rotating if the
+    // subtrees differ in height by two. Rotations never touch the old nodes,
+    // they create new ones and share the grandchildren instead.
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLNode<Key, Value>* PersistentAVLTree<Key, Value>::_balance(const Key& key, const Value& value, PersistentAVLNode<Key, Value>* left, PersistentAVLNode<Key, Value>* right) {
+        const int bf = _height(left) - _height(right);
+
+        if (bf > 1) {
+            PersistentAVLNode<Key, Value>* newRoot = nullptr;
+            // Left-Left imbalance
+            if (_height(left->left) >= _height(left->right)) {
+                PersistentAVLNode<Key, Value>* newRight = _make_node(key, value, _retain(left->right), right);
+                newRoot = _make_node(left->key, left->data, _retain(left->left), newRight);
+            }
+            // Left-Right imbalance
+            else {
+                PersistentAVLNode<Key, Value>* pivot = left->right;
+                PersistentAVLNode<Key, Value>* newLeft = _make_node(left->key, left->data, _retain(left->left), _retain(pivot->left));
+                PersistentAVLNode<Key, Value>* newRight = _make_node(key, value, _retain(pivot->right), right);
+                newRoot = _make_node(pivot->key, pivot->data, newLeft, newRight);
+            }
+            _release(left);
+            return newRoot;
+        }
+        else if (bf < -1) {
+            PersistentAVLNode<Key, Value>* newRoot = nullptr;
+            // Right-Right imbalance
+            if (_height(right->right) >= _height(right->left)) {
+                PersistentAVLNode<Key, Value>* newLeft = _make_node(key, value, left, _retain(right->left));
+                newRoot = _make_node(right->key, right->data, newLeft, _retain(right->right));
+            }
+            // Right-Left imbalance
+            else {
+                PersistentAVLNode<Key, Value>* pivot = right->left;
+                PersistentAVLNode<Key, Value>* newLeft = _make_node(key, value, left, _retain(pivot->left));
+                PersistentAVLNode<Key, Value>* newRight = _make_node(right->key, right->data, _retain(pivot->right), _retain(right->right));
+                newRoot = _make_node(pivot->key, pivot->data, newLeft, newRight);
+            }
+            _release(right);
+            return newRoot;
+        }
+
+        return _make_node(key, value, left, right);
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLNode<Key, Value>* PersistentAVLTree<Key, Value>::_insert(const PersistentAVLNode<Key, Value>* root, const Key& key, const Value& value) const {
+        if (root == nullptr) {
+            return _make_node(key, value, nullptr, nullptr);
+        }
+        else if (_compare(key, root->key) < 0) {
+            PersistentAVLNode<Key, Value>* newLeft = _insert(root->left, key, value);
+            return _balance(root->key, root->data, newLeft, _retain(root->right));
+        }
+        else if (_compare(key, root->key) > 0) {
+            PersistentAVLNode<Key, Value>* newRight = _insert(root->right, key, value);
+            return _balance(root->key, root->data, _retain(root->left), newRight);
+        }
+        else {
+            throw std::runtime_error("Key already exist.");
+        }
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLNode<Key, Value>* PersistentAVLTree<Key, Value>::_remove(const PersistentAVLNode<Key, Value>* root, const Key& key) const {
+        if (root == nullptr) {
+            throw std::out_of_range("Key does not exist.");
+        }
+        else if (_compare(key, root->key) < 0) {
+            PersistentAVLNode<Key, Value>* newLeft = _remove(root->left, key);
+            return _balance(root->key, root->data, newLeft, _retain(root->right));
+        }
+        else if (_compare(key, root->key) > 0) {
+            PersistentAVLNode<Key, Value>* newRight = _remove(root->right, key);
+            return _balance(root->key, root->data, _retain(root->left), newRight);
+        }
+        else {
+            if (root->left == nullptr) {
+                return _retain(root->right);
+            }
+            else if (root->right == nullptr) {
+                return _retain(root->left);
+            }
+            else {
+                // The successor stays alive while we copy it, because the
+                // previous version still holds a reference to root->right.
+                const PersistentAVLNode<Key, Value>* successor = root->right;
+                while (successor->left != nullptr) {
+                    successor = successor->left;
+                }
+
+                PersistentAVLNode<Key, Value>* newRight = _remove_min(root->right);
+                return _balance(successor->key, successor->data, _retain(root->left), newRight);
+            }
+        }
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLNode<Key, Value>* PersistentAVLTree<Key, Value>::_remove_min(const PersistentAVLNode<Key, Value>* root) {
+        if (root->left == nullptr) {
+            return _retain(root->right);
+        }
+
+        PersistentAVLNode<Key, Value>* newLeft = _remove_min(root->left);
+        return _balance(root->key, root->data, newLeft, _retain(root->right));
+    }
+
+    template <typename Key, typename Value>
+    void PersistentAVLTree<Key, Value>::_preorder(const PersistentAVLNode<Key, Value>* root, std::ostringstream& outstring) const {
+        if (root != nullptr) {
+            outstring << "{" << root->key << ":" << " " << root->data << "} ";
+            _preorder(root->left, outstring);
+            _preorder(root->right, outstring);
+        }
+    }
+
+    template <typename Key, typename Value>
+    void PersistentAVLTree<Key, Value>::_inorder(const PersistentAVLNode<Key, Value>* root, std::ostringstream& outstring) const {
+        if (root != nullptr) {
+            _inorder(root->left, outstring);
+            outstring << "{" << root->key << ":" << " " << root->data << "} ";
+            _inorder(root->right, outstring);
+        }
+    }
+
+    template <typename Key, typename Value>
+    void PersistentAVLTree<Key, Value>::_postorder(const PersistentAVLNode<Key, Value>* root, std::ostringstream& outstring) const {
+        if (root != nullptr) {
+            _postorder(root->left, outstring);
+            _postorder(root->right, outstring);
+            outstring << "{" << root->key << ":" << " " << root->data << "} ";
+        }
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLTree(int (*comparator)(const Key& key1, const Key& key2)) {
+        m_root = nullptr;
+        m_size = 0;
+        _compare = comparator;
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::PersistentAVLTree(const PersistentAVLTree<Key, Value>& other) {
+        m_root = _retain(other.m_root);
+        m_size = other.m_size;
+        _compare = other._compare;
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>& PersistentAVLTree<Key, Value>::operator=(const PersistentAVLTree<Key, Value>& other) {
+        // Retain before releasing so that self-assignment stays valid.
+        PersistentAVLNode<Key, Value>* newRoot = _retain(other.m_root);
+        _release(m_root);
+        m_root = newRoot;
+        m_size = other.m_size;
+        _compare = other._compare;
+        return *this;
+    }
+
+    template <typename Key, typename Value>
+    void PersistentAVLTree<Key, Value>::insert(const Key& key, const Value& value) {
+        PersistentAVLNode<Key, Value>* newRoot = _insert(m_root, key, value);
+        _release(m_root);
+        m_root = newRoot;
+        m_size++;
+    }
+
+    template <typename Key, typename Value>
+    void PersistentAVLTree<Key, Value>::remove(const Key& key) {
+        if (m_root == nullptr) {
+            throw std::underflow_error("Tree is empty.");
+        }
+
+        PersistentAVLNode<Key, Value>* newRoot = _remove(m_root, key);
+        _release(m_root);
+        m_root = newRoot;
+        m_size--;
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value> PersistentAVLTree<Key, Value>::snapshot() const {
+        return PersistentAVLTree<Key, Value>(*this);
+    }
+
+    template <typename Key, typename Value>
+    bool PersistentAVLTree<Key, Value>::is_empty() const {
+        return m_size == 0;
+    }
+
+    template <typename Key, typename Value>
+    std::size_t PersistentAVLTree<Key, Value>::size() const {
+        return m_size;
+    }
+
+    template <typename Key, typename Value>
+    const Value& PersistentAVLTree<Key, Value>::min() const {
+        if (m_root == nullptr) {
+            throw std::out_of_range("Tree is empty");
+        }
+
+        const PersistentAVLNode<Key, Value>* cursor = m_root;
+        while (cursor->left != nullptr) {
+            cursor = cursor->left;
+        }
+
+        return cursor->data;
+    }
+
+    template <typename Key, typename Value>
+    const Value& PersistentAVLTree<Key, Value>::max() const {
+        if (m_root == nullptr) {
+            throw std::out_of_range("Tree is empty");
+        }
+
+        const PersistentAVLNode<Key, Value>* cursor = m_root;
+        while (cursor->right != nullptr) {
+            cursor = cursor->right;
+        }
+
+        return cursor->data;
+    }
+
+    template <typename Key, typename Value>
+    bool PersistentAVLTree<Key, Value>::contains(const Key& key) const {
+        const PersistentAVLNode<Key, Value>* cursor = m_root;
+        while (cursor != nullptr) {
+            if (_compare(key, cursor->key) < 0) {
+                cursor = cursor->left;
+            }
+            else if (_compare(key, cursor->key) > 0) {
+                cursor = cursor->right;
+            }
+            else {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <typename Key, typename Value>
+    const Value& PersistentAVLTree<Key, Value>::at(const Key& key) const {
+        const PersistentAVLNode<Key, Value>* cursor = m_root;
+        while (cursor != nullptr) {
+            if (_compare(key, cursor->key) < 0) {
+                cursor = cursor->left;
+            }
+            else if (_compare(key, cursor->key) > 0) {
+                cursor = cursor->right;
+            }
+            else {
+                return cursor->data;
+            }
+        }
+
+        throw std::out_of_range("Key does not exist.");
+    }
+
+    template <typename Key, typename Value>
+    std::string PersistentAVLTree<Key, Value>::preorder() const {
+        std::ostringstream outstring;
+        _preorder(m_root, outstring);
+        return outstring.str();
+    }
+
+    template <typename Key, typename Value>
+    std::string PersistentAVLTree<Key, Value>::inorder() const {
+        std::ostringstream outstring;
+        _inorder(m_root, outstring);
+        return outstring.str();
+    }
+
+    template <typename Key, typename Value>
+    std::string PersistentAVLTree<Key, Value>::postorder() const {
+        std::ostringstream outstring;
+        _postorder(m_root, outstring);
+        return outstring.str();
+    }
+
+    template <typename Key, typename Value>
+    PersistentAVLTree<Key, Value>::~PersistentAVLTree() {
+        _release(m_root);
+        m_root = nullptr;
+        m_size = 0;
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_PERSISTENT_AVL_TREE_IPP_
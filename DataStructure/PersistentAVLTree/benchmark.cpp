@@ -0,0 +1,141 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../AVLTree/AVLTree.hpp"
+#include "../Benchmark/Benchmark.hpp"
+#include "PersistentAVLTree.hpp"
+
+// Number of tree elements, snapshot rounds, updates applied after every
+// snapshot, and how many of the most recent snapshots are kept alive.
+static std::size_t g_elements = 200000;
+static std::size_t g_rounds = 20;
+static std::size_t g_updates = 1000;
+static std::size_t g_retained = 4;
+
+// An AVLTree snapshot is a deep copy of every node.
+static void bench_full_copy() {
+    std::mt19937 rng(42);
+    std::vector<int> keys;
+    std::size_t baseBytes = g_liveBytes;
+
+    DSA::AVLTree<int, int>* tree = new DSA::AVLTree<int, int>();
+    for (std::size_t i = 0; i < g_elements; i++) {
+        keys.push_back(static_cast<int>(i));
+        tree->insert(static_cast<int>(i), static_cast<int>(i));
+    }
+    int nextKey = static_cast<int>(g_elements);
+
+    std::vector<DSA::AVLTree<int, int>*> snapshots;
+    std::size_t peakBytes = 0;
+    double snapshotMs = 0;
+    double updateMs = 0;
+
+    for (std::size_t round = 0; round < g_rounds; round++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        DSA::AVLTree<int, int>* copy = new DSA::AVLTree<int, int>(*tree);
+        snapshotMs += elapsed_ms(start);
+
+        snapshots.push_back(copy);
+        if (snapshots.size() > g_retained) {
+            delete snapshots.front();
+            snapshots.erase(snapshots.begin());
+        }
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < g_updates; i++) {
+            std::size_t victim = rng() % keys.size();
+            tree->remove(keys[victim]);
+            keys[victim] = nextKey;
+            tree->insert(nextKey, nextKey);
+            nextKey++;
+        }
+        updateMs += elapsed_ms(start);
+
+        peakBytes = std::max(peakBytes, g_liveBytes - baseBytes);
+    }
+
+    std::cout << "AVLTree deep copy" << std::endl;
+    std::cout << "  snapshot: " << snapshotMs / g_rounds << " ms/op" << std::endl;
+    std::cout << "  update:   " << updateMs * 1e6 / (g_rounds * g_updates) << " ns/op" << std::endl;
+    std::cout << "  rounds/s: " << g_rounds * 1000.0 / (snapshotMs + updateMs) << std::endl;
+    std::cout << "  peak heap: " << peakBytes / (1024.0 * 1024.0) << " MiB" << std::endl;
+
+    for (std::size_t i = 0; i < snapshots.size(); i++) {
+        delete snapshots[i];
+    }
+    delete tree;
+}
+
+static void bench_persistent() {
+    std::mt19937 rng(42);
+    std::vector<int> keys;
+    std::size_t baseBytes = g_liveBytes;
+
+    DSA::PersistentAVLTree<int, int>* tree = new DSA::PersistentAVLTree<int, int>();
+    for (std::size_t i = 0; i < g_elements; i++) {
+        keys.push_back(static_cast<int>(i));
+        tree->insert(static_cast<int>(i), static_cast<int>(i));
+    }
+    int nextKey = static_cast<int>(g_elements);
+
+    std::vector<DSA::PersistentAVLTree<int, int>*> snapshots;
+    std::size_t singleVersionBytes = g_liveBytes - baseBytes;
+    std::size_t peakBytes = 0;
+    double snapshotMs = 0;
+    double updateMs = 0;
+
+    for (std::size_t round = 0; round < g_rounds; round++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        DSA::PersistentAVLTree<int, int>* copy = new DSA::PersistentAVLTree<int, int>(tree->snapshot());
+        snapshotMs += elapsed_ms(start);
+
+        snapshots.push_back(copy);
+        if (snapshots.size() > g_retained) {
+            delete snapshots.front();
+            snapshots.erase(snapshots.begin());
+        }
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < g_updates; i++) {
+            std::size_t victim = rng() % keys.size();
+            tree->remove(keys[victim]);
+            keys[victim] = nextKey;
+            tree->insert(nextKey, nextKey);
+            nextKey++;
+        }
+        updateMs += elapsed_ms(start);
+
+        peakBytes = std::max(peakBytes, g_liveBytes - baseBytes);
+    }
+
+    std::cout << "PersistentAVLTree snapshot" << std::endl;
+    std::cout << "  snapshot: " << snapshotMs / g_rounds << " ms/op" << std::endl;
+    std::cout << "  update:   " << updateMs * 1e6 / (g_rounds * g_updates) << " ns/op" << std::endl;
+    std::cout << "  rounds/s: " << g_rounds * 1000.0 / (snapshotMs + updateMs) << std::endl;
+    std::cout << "  peak heap: " << peakBytes / (1024.0 * 1024.0) << " MiB"
+              << " (single version: " << singleVersionBytes / (1024.0 * 1024.0) << " MiB)" << std::endl;
+
+    for (std::size_t i = 0; i < snapshots.size(); i++) {
+        delete snapshots[i];
+    }
+    delete tree;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_elements = std::strtoull(argv[1], nullptr, 10);
+    if (argc > 2) g_rounds = std::strtoull(argv[2], nullptr, 10);
+    if (argc > 3) g_updates = std::strtoull(argv[3], nullptr, 10);
+    if (argc > 4) g_retained = std::strtoull(argv[4], nullptr, 10);
+
+    std::cout << "elements: " << g_elements << " | rounds: " << g_rounds
+              << " | updates/round: " << g_updates << " | retained snapshots: " << g_retained << std::endl;
+    std::cout << std::endl;
+
+    bench_full_copy();
+    std::cout << std::endl;
+    bench_persistent();
+    return 0;
+}
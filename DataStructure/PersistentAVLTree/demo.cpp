@@ -0,0 +1,44 @@
+#include <iostream>
+#include <string>
+#include "PersistentAVLTree.hpp"
+
+int main() {
+    DSA::PersistentAVLTree<int, int> avl;
+    std::cout << "Initialized Persistent AVL Tree" << std::endl;
+    std::cout << std::endl;
+
+    avl.insert(30, 30);
+    avl.insert(20, 20);
+    avl.insert(10, 10);
+    avl.insert(40, 40);
+    avl.insert(75, 75);
+    avl.insert(13, 13);
+    avl.insert(12, 12);
+    avl.insert(19, 19);
+    std::cout << "Inserted {30, 30}, {20, 20}, {10, 10}, {40, 40}, {75, 75}, {13, 13}, {12, 12}, {19, 19} via insert()" << std::endl;
+    std::cout << "PREORDER: " << avl.preorder() << std::endl;
+    std::cout << "INORDER: " << avl.inorder() << std::endl;
+    std::cout << "POSTORDER: " << avl.postorder() << std::endl;
+    std::cout << "VALUE OF MIN MAX KEY: " << avl.min() << " " << avl.max() << std::endl;
+    std::cout << "SIZE: " << avl.size() << std::endl;
+    std::cout << std::endl;
+
+    const DSA::PersistentAVLTree<int, int> snapshot = avl.snapshot();
+    std::cout << "Took a snapshot via snapshot()" << std::endl;
+    std::cout << std::endl;
+
+    avl.remove(75);
+    avl.remove(20);
+    avl.insert(50, 50);
+    std::cout << "Removed keys 75 and 20, then inserted {50, 50}" << std::endl;
+    std::cout << "CURRENT INORDER: " << avl.inorder() << std::endl;
+    std::cout << "CURRENT PREORDER: " << avl.preorder() << std::endl;
+    std::cout << "CURRENT SIZE: " << avl.size() << std::endl;
+    std::cout << "SNAPSHOT INORDER: " << snapshot.inorder() << std::endl;
+    std::cout << "SNAPSHOT PREORDER: " << snapshot.preorder() << std::endl;
+    std::cout << "SNAPSHOT SIZE: " << snapshot.size() << std::endl;
+    std::cout << "SNAPSHOT CONTAINS 75: " << snapshot.contains(75) << " | CURRENT CONTAINS 75: " << avl.contains(75) << std::endl;
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -104,7 +104,6 @@ namespace DSA {
 
     template <typename T>
     PriorityQueue<T>::~PriorityQueue() {
-        m_data.~DynamicArray();
     }
 }
 
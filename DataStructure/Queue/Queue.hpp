@@ -17,10 +17,19 @@ namespace DSA {
         QueueNode<T>* m_tail;
         std::size_t m_size;
 
+        void _clear();
+
     public:   
         Queue();
+        Queue(const Queue<T>& other);
+        Queue(Queue<T>&& other) noexcept;
+        Queue<T>& operator=(const Queue<T>& other);
+        Queue<T>& operator=(Queue<T>&& other) noexcept;
 
         void enqueue(const T& value);
+        void enqueue(T&& value);
+        template <typename... Args>
+        void emplace(Args&&... args);
         void dequeue();
         
         const T& peek_front() const;
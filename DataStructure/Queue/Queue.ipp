@@ -3,9 +3,21 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 #include "Queue.hpp"
 
 namespace DSA {
+    template <typename T>
+    void Queue<T>::_clear() {
+        while (!is_empty()) {
+            QueueNode<T>* nextElement = m_head->next;
+            delete m_head;
+            m_head = nextElement;
+            m_size--;
+        }
+        m_tail = nullptr;
+    }
+
     template <typename T>
     Queue<T>::Queue() {
         m_head = nullptr;
@@ -13,11 +25,72 @@ namespace DSA {
         m_size = 0;
     }
 
+    template <typename T>
+    Queue<T>::Queue(const Queue<T>& other) {
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
+
+        try {
+            for (QueueNode<T>* cursor = other.m_head; cursor != nullptr; cursor = cursor->next) {
+                enqueue(cursor->data);
+            }
+        }
+        catch (...) {
+            _clear();
+            throw;
+        }
+    }
+
+    template <typename T>
+    Queue<T>::Queue(Queue<T>&& other) noexcept {
+        m_head = other.m_head;
+        m_tail = other.m_tail;
+        m_size = other.m_size;
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+
+    template <typename T>
+    Queue<T>& Queue<T>::operator=(const Queue<T>& other) {
+        if (this != &other) {
+            Queue<T> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    Queue<T>& Queue<T>::operator=(Queue<T>&& other) noexcept {
+        if (this != &other) {
+            _clear();
+            m_head = other.m_head;
+            m_tail = other.m_tail;
+            m_size = other.m_size;
+            other.m_head = nullptr;
+            other.m_tail = nullptr;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
     template <typename T>
     void Queue<T>::enqueue(const T& value) {
-        QueueNode<T>* newElement = new QueueNode<T>();
-        newElement->data = value;
-        newElement->next = nullptr;
+        emplace(value);
+    }
+
+    template <typename T>
+    void Queue<T>::enqueue(T&& value) {
+        emplace(std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void Queue<T>::emplace(Args&&... args) {
+        QueueNode<T>* newElement = new QueueNode<T>{T(std::forward<Args>(args)...), nullptr};
         
         if (is_empty()) {
             m_head = newElement;
@@ -70,12 +143,7 @@ namespace DSA {
 
     template <typename T>
     Queue<T>::~Queue() {
-        while (!is_empty()) {
-            QueueNode<T>* nextElement = m_head->next;
-            delete m_head;
-            m_head = nextElement;
-            m_size--;
-        }
+        _clear();
     }
 }
 
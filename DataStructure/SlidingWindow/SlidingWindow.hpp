@@ -0,0 +1,135 @@
+#ifndef CPPDSA_DATA_STRUCTURE_SLIDING_WINDOW_HPP_
+#define CPPDSA_DATA_STRUCTURE_SLIDING_WINDOW_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace DSA {
+    // Operations for SlidingWindow. An operation has an identity and an
+    // associative combine(older, newer). Selective operations such as min and
+    // max, whose result is always one of the inputs, also provide
+    // dominates(newer, older): true when the older element can never be the
+    // result again once the newer one is in the window.
+    template <typename T>
+    struct WindowSum {
+        static T identity() { return T(); }
+        static T combine(const T& older, const T& newer) { return older + newer; }
+    };
+
+    template <typename T>
+    struct WindowMin {
+        static T identity() { return std::numeric_limits<T>::max(); }
+        static T combine(const T& older, const T& newer) { return (newer < older) ? newer : older; }
+        static bool dominates(const T& newer, const T& older) { return !(older < newer); }
+    };
+
+    template <typename T>
+    struct WindowMax {
+        static T identity() { return std::numeric_limits<T>::lowest(); }
+        static T combine(const T& older, const T& newer) { return (older < newer) ? newer : older; }
+        static bool dominates(const T& newer, const T& older) { return !(newer < older); }
+    };
+
+    // Aggregates the most recent elements of a stream under an associative
+    // operation with amortized O(1) push, evict and query.
+    //
+    // The window can be bounded by count (keep the last `count` elements), by
+    // time (keep the elements whose timestamp is within `span` of the newest
+    // one), by both, or by neither and evicted by hand.
+    //
+    // Elements live in a ring buffer, never in individual heap nodes. For a
+    // selective operation a second ring keeps the monotonic sequence of
+    // elements that can still become the result, so the answer is always at
+    // its front. Any other operation uses the two-stacks algorithm on the ring
+    // itself: the older part of the window holds suffix aggregates, the newer
+    // part holds raw values plus one running aggregate, and when the older
+    // part runs out the whole window is folded into suffix aggregates again.
+    template <typename T, typename Op = WindowSum<T>>
+    class SlidingWindow {
+    private:
+        // Tells whether an operation provides dominates() and is therefore
+        // selective.
+        template <typename O, typename = void>
+        struct SelectiveTest : std::false_type {};
+
+        template <typename O>
+        struct SelectiveTest<O, std::void_t<decltype(O::dominates(std::declval<const T&>(), std::declval<const T&>()))>>
+            : std::is_same<decltype(O::dominates(std::declval<const T&>(), std::declval<const T&>())), bool> {};
+
+        static constexpr bool _SELECTIVE = SelectiveTest<Op>::value;
+        static constexpr std::size_t _RING_INIT_SIZE = 8;
+
+        template <typename U>
+        struct WindowEntry {
+            U value;
+            std::uint64_t stamp;
+        };
+
+        // A growable circular array. Indices passed to operator[] count from
+        // the oldest entry.
+        template <typename U>
+        struct WindowRing {
+            U* slots;
+            std::size_t capacity;
+            std::size_t head;
+            std::size_t count;
+
+            WindowRing();
+            WindowRing(const WindowRing<U>& other);
+            WindowRing(WindowRing<U>&& other) noexcept;
+            WindowRing<U>& operator=(WindowRing<U>&& other) noexcept;
+
+            void push_back(const U& value);
+            void pop_front();
+            void pop_back();
+            U& operator[](const std::size_t index);
+            const U& operator[](const std::size_t index) const;
+
+            ~WindowRing();
+        };
+
+        // Every element with its timestamp. For a general operation the first
+        // m_frontCount values are suffix aggregates instead of raw values.
+        WindowRing<WindowEntry<T>> m_entries;
+        // Selective operations only: candidates for the result, stamped with
+        // their sequence number.
+        WindowRing<WindowEntry<T>> m_monotonic;
+
+        std::size_t m_frontCount;
+        T m_backAggregate;
+        std::uint64_t m_pushed;
+        std::uint64_t m_evicted;
+
+        std::size_t m_maxCount;
+        std::uint64_t m_span;
+        std::uint64_t m_now;
+
+        void _flip();
+
+    public:
+        SlidingWindow(const std::size_t count = 0, const std::uint64_t span = 0);
+        SlidingWindow(const SlidingWindow<T, Op>& other);
+        SlidingWindow(SlidingWindow<T, Op>&& other) noexcept;
+        SlidingWindow<T, Op>& operator=(const SlidingWindow<T, Op>& other);
+        SlidingWindow<T, Op>& operator=(SlidingWindow<T, Op>&& other) noexcept;
+
+        void push(const T& value, const std::uint64_t timestamp = 0);
+        void evict();
+        void advance(const std::uint64_t now);
+        void clear();
+
+        T query() const;
+
+        bool is_empty() const;
+        std::size_t size() const;
+
+        ~SlidingWindow();
+    };
+}
+
+#include "SlidingWindow.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_SLIDING_WINDOW_HPP_
@@ -0,0 +1,304 @@
+#ifndef CPPDSA_DATA_STRUCTURE_SLIDING_WINDOW_IPP_
+#define CPPDSA_DATA_STRUCTURE_SLIDING_WINDOW_IPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include "SlidingWindow.hpp"
+
+namespace DSA {
+    template <typename T, typename Op>
+    template <typename U>
+    SlidingWindow<T, Op>::WindowRing<U>::WindowRing() {
+        slots = nullptr;
+        capacity = 0;
+        head = 0;
+        count = 0;
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    SlidingWindow<T, Op>::WindowRing<U>::WindowRing(const WindowRing<U>& other) {
+        slots = (other.capacity > 0) ? new U[other.capacity] : nullptr;
+        capacity = other.capacity;
+        head = 0;
+        count = other.count;
+        for (std::size_t i = 0; i < count; i++) {
+            slots[i] = other[i];
+        }
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    SlidingWindow<T, Op>::WindowRing<U>::WindowRing(WindowRing<U>&& other) noexcept {
+        slots = other.slots;
+        capacity = other.capacity;
+        head = other.head;
+        count = other.count;
+        other.slots = nullptr;
+        other.capacity = 0;
+        other.head = 0;
+        other.count = 0;
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    SlidingWindow<T, Op>::WindowRing<U>& SlidingWindow<T, Op>::WindowRing<U>::operator=(WindowRing<U>&& other) noexcept {
+        if (this != &other) {
+            delete[] slots;
+            slots = other.slots;
+            capacity = other.capacity;
+            head = other.head;
+            count = other.count;
+            other.slots = nullptr;
+            other.capacity = 0;
+            other.head = 0;
+            other.count = 0;
+        }
+
+        return *this;
+    }
+
+    // The capacity is always a power of two so that wrapping around is a mask.
+    template <typename T, typename Op>
+    template <typename U>
+    void SlidingWindow<T, Op>::WindowRing<U>::push_back(const U& value) {
+        if (count == capacity) {
+            const std::size_t newCapacity = (capacity == 0) ? _RING_INIT_SIZE : 2 * capacity;
+            U* newSlots = new U[newCapacity];
+            for (std::size_t i = 0; i < count; i++) {
+                newSlots[i] = std::move((*this)[i]);
+            }
+
+            delete[] slots;
+            slots = newSlots;
+            capacity = newCapacity;
+            head = 0;
+        }
+
+        slots[(head + count) & (capacity - 1)] = value;
+        count++;
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    inline void SlidingWindow<T, Op>::WindowRing<U>::pop_front() {
+        // Slots are reused rather than destroyed, so the evicted value is
+        // moved out into a temporary to release whatever it owns. Assigning
+        // U() would not do, since std::string keeps its capacity that way.
+        static_cast<void>(U(std::move(slots[head])));
+        head = (head + 1) & (capacity - 1);
+        count--;
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    inline void SlidingWindow<T, Op>::WindowRing<U>::pop_back() {
+        count--;
+        static_cast<void>(U(std::move(slots[(head + count) & (capacity - 1)])));
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    inline U& SlidingWindow<T, Op>::WindowRing<U>::operator[](const std::size_t index) {
+        return slots[(head + index) & (capacity - 1)];
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    inline const U& SlidingWindow<T, Op>::WindowRing<U>::operator[](const std::size_t index) const {
+        return slots[(head + index) & (capacity - 1)];
+    }
+
+    template <typename T, typename Op>
+    template <typename U>
+    SlidingWindow<T, Op>::WindowRing<U>::~WindowRing() {
+        delete[] slots;
+    }
+
+    // Turns the whole window into the older part by replacing every value with
+    // the aggregate of itself and everything newer. Each element takes part in
+    // at most one flip between being pushed and being evicted, which is what
+    // makes eviction amortized O(1).
+    template <typename T, typename Op>
+    void SlidingWindow<T, Op>::_flip() {
+        T aggregate = Op::identity();
+        for (std::size_t i = m_entries.count; i > 0; i--) {
+            aggregate = Op::combine(m_entries[i - 1].value, aggregate);
+            m_entries[i - 1].value = aggregate;
+        }
+
+        m_frontCount = m_entries.count;
+        m_backAggregate = Op::identity();
+    }
+
+    template <typename T, typename Op>
+    SlidingWindow<T, Op>::SlidingWindow(const std::size_t count, const std::uint64_t span) {
+        m_frontCount = 0;
+        m_backAggregate = Op::identity();
+        m_pushed = 0;
+        m_evicted = 0;
+        m_maxCount = count;
+        m_span = span;
+        m_now = 0;
+    }
+
+    template <typename T, typename Op>
+    SlidingWindow<T, Op>::SlidingWindow(const SlidingWindow<T, Op>& other)
+        : m_entries(other.m_entries), m_monotonic(other.m_monotonic) {
+        m_frontCount = other.m_frontCount;
+        m_backAggregate = other.m_backAggregate;
+        m_pushed = other.m_pushed;
+        m_evicted = other.m_evicted;
+        m_maxCount = other.m_maxCount;
+        m_span = other.m_span;
+        m_now = other.m_now;
+    }
+
+    template <typename T, typename Op>
+    SlidingWindow<T, Op>::SlidingWindow(SlidingWindow<T, Op>&& other) noexcept
+        : m_entries(std::move(other.m_entries)), m_monotonic(std::move(other.m_monotonic)) {
+        m_frontCount = other.m_frontCount;
+        m_backAggregate = std::move(other.m_backAggregate);
+        m_pushed = other.m_pushed;
+        m_evicted = other.m_evicted;
+        m_maxCount = other.m_maxCount;
+        m_span = other.m_span;
+        m_now = other.m_now;
+        other.m_frontCount = 0;
+        other.m_backAggregate = Op::identity();
+        other.m_pushed = 0;
+        other.m_evicted = 0;
+    }
+
+    template <typename T, typename Op>
+    SlidingWindow<T, Op>& SlidingWindow<T, Op>::operator=(const SlidingWindow<T, Op>& other) {
+        if (this != &other) {
+            SlidingWindow<T, Op> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T, typename Op>
+    SlidingWindow<T, Op>& SlidingWindow<T, Op>::operator=(SlidingWindow<T, Op>&& other) noexcept {
+        if (this != &other) {
+            m_entries = std::move(other.m_entries);
+            m_monotonic = std::move(other.m_monotonic);
+            m_frontCount = other.m_frontCount;
+            m_backAggregate = std::move(other.m_backAggregate);
+            m_pushed = other.m_pushed;
+            m_evicted = other.m_evicted;
+            m_maxCount = other.m_maxCount;
+            m_span = other.m_span;
+            m_now = other.m_now;
+            other.m_frontCount = 0;
+            other.m_backAggregate = Op::identity();
+            other.m_pushed = 0;
+            other.m_evicted = 0;
+        }
+
+        return *this;
+    }
+
+    template <typename T, typename Op>
+    void SlidingWindow<T, Op>::push(const T& value, const std::uint64_t timestamp) {
+        advance(timestamp);
+        if (m_maxCount > 0 && size() == m_maxCount) {
+            evict();
+        }
+
+        m_entries.push_back(WindowEntry<T>{value, timestamp});
+        if constexpr (_SELECTIVE) {
+            while (m_monotonic.count > 0 && Op::dominates(value, m_monotonic[m_monotonic.count - 1].value)) {
+                m_monotonic.pop_back();
+            }
+            m_monotonic.push_back(WindowEntry<T>{value, m_pushed});
+        }
+        else {
+            m_backAggregate = Op::combine(m_backAggregate, value);
+        }
+        m_pushed++;
+    }
+
+    template <typename T, typename Op>
+    void SlidingWindow<T, Op>::evict() {
+        if (is_empty()) {
+            throw std::underflow_error("Window is empty.");
+        }
+
+        if constexpr (_SELECTIVE) {
+            if (m_monotonic.count > 0 && m_monotonic[0].stamp == m_evicted) {
+                m_monotonic.pop_front();
+            }
+        }
+        else {
+            if (m_frontCount == 0) {
+                _flip();
+            }
+            m_frontCount--;
+        }
+        m_entries.pop_front();
+        m_evicted++;
+    }
+
+    // Moves the clock to now and, for a time-based window, evicts every element
+    // whose timestamp is span or more behind it.
+    template <typename T, typename Op>
+    void SlidingWindow<T, Op>::advance(const std::uint64_t now) {
+        if (now < m_now) {
+            throw std::invalid_argument("Time cannot go backwards.");
+        }
+        m_now = now;
+
+        if (m_span > 0) {
+            while (!is_empty() && now - m_entries[0].stamp >= m_span) {
+                evict();
+            }
+        }
+    }
+
+    // Empties the window and restarts its clock, so that it can take a new
+    // stream whose timestamps start again from zero.
+    template <typename T, typename Op>
+    void SlidingWindow<T, Op>::clear() {
+        m_entries = WindowRing<WindowEntry<T>>();
+        m_monotonic = WindowRing<WindowEntry<T>>();
+        m_frontCount = 0;
+        m_backAggregate = Op::identity();
+        m_pushed = 0;
+        m_evicted = 0;
+        m_now = 0;
+    }
+
+    template <typename T, typename Op>
+    T SlidingWindow<T, Op>::query() const {
+        if constexpr (_SELECTIVE) {
+            return (m_monotonic.count > 0) ? m_monotonic[0].value : Op::identity();
+        }
+        else {
+            if (m_frontCount == 0) {
+                return m_backAggregate;
+            }
+            return Op::combine(m_entries[0].value, m_backAggregate);
+        }
+    }
+
+    template <typename T, typename Op>
+    inline bool SlidingWindow<T, Op>::is_empty() const {
+        return m_entries.count == 0;
+    }
+
+    template <typename T, typename Op>
+    inline std::size_t SlidingWindow<T, Op>::size() const {
+        return m_entries.count;
+    }
+
+    template <typename T, typename Op>
+    SlidingWindow<T, Op>::~SlidingWindow() {
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_SLIDING_WINDOW_IPP_
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../Benchmark/Timer.hpp"
+#include "../Deque/Deque.hpp"
+#include "SlidingWindow.hpp"
+
+// Measures one step of a count-based window: push a new value, evict the
+// oldest one and query the aggregate. The baseline keeps the raw window in a
+// Deque and rescans it on every query, which costs O(window) per step, so it
+// runs fewer steps at large windows (at most g_rescanBudget elements visited).
+//
+// A time-based window is measured the same way, except that every value
+// arrives 0 to 3 ticks after the previous one and the window keeps the last
+// `window` ticks, so each step evicts a varying number of values, often none
+// and sometimes several.
+
+static std::size_t g_steps = 10000000;
+static std::size_t g_rescanBudget = 300000000;
+static std::size_t g_maxWindow = 1000000;
+
+static const std::uint64_t g_maxGap = 3;
+
+struct TimedValue {
+    long long value;
+    std::uint64_t stamp;
+};
+
+template <typename Op>
+static double bench_window(const std::vector<long long>& stream, std::size_t window, long long& checksum) {
+    DSA::SlidingWindow<long long, Op> sliding(window);
+    for (std::size_t i = 0; i < window; i++) {
+        sliding.push(stream[i % stream.size()]);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < g_steps; i++) {
+        sliding.push(stream[(window + i) % stream.size()]);
+        checksum += sliding.query();
+    }
+    return elapsed_ns(start) / g_steps;
+}
+
+template <typename Op>
+static double bench_rescan(const std::vector<long long>& stream, std::size_t window, long long& checksum) {
+    DSA::Deque<long long> deque;
+    for (std::size_t i = 0; i < window; i++) {
+        deque.push_back(stream[i % stream.size()]);
+    }
+
+    const std::size_t steps = std::max<std::size_t>(1, std::min(g_steps, g_rescanBudget / window));
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < steps; i++) {
+        deque.pop_front();
+        deque.push_back(stream[(window + i) % stream.size()]);
+
+        long long aggregate = Op::identity();
+        deque.for_each([&aggregate](const long long& value) {
+            aggregate = Op::combine(aggregate, value);
+        });
+        checksum += aggregate;
+    }
+    return elapsed_ns(start) / steps;
+}
+
+// The gap before each value comes from the stream itself, so both sides see
+// the same timestamps.
+static std::uint64_t next_stamp(std::uint64_t now, long long value) {
+    return now + static_cast<std::uint64_t>(value) % (g_maxGap + 1);
+}
+
+template <typename Op>
+static double bench_timed_window(const std::vector<long long>& stream, std::uint64_t span, long long& checksum) {
+    DSA::SlidingWindow<long long, Op> sliding(0, span);
+    std::uint64_t now = 0;
+    std::size_t position = 0;
+    while (now < span) {
+        const long long value = stream[position++ % stream.size()];
+        now = next_stamp(now, value);
+        sliding.push(value, now);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < g_steps; i++) {
+        const long long value = stream[position++ % stream.size()];
+        now = next_stamp(now, value);
+        sliding.push(value, now);
+        checksum += sliding.query();
+    }
+    return elapsed_ns(start) / g_steps;
+}
+
+template <typename Op>
+static double bench_timed_rescan(const std::vector<long long>& stream, std::uint64_t span, long long& checksum) {
+    DSA::Deque<TimedValue> deque;
+    std::uint64_t now = 0;
+    std::size_t position = 0;
+    while (now < span) {
+        const long long value = stream[position++ % stream.size()];
+        now = next_stamp(now, value);
+        deque.push_back(TimedValue{value, now});
+    }
+
+    const std::size_t steps = std::max<std::size_t>(1, std::min<std::size_t>(g_steps, g_rescanBudget / span));
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < steps; i++) {
+        const long long value = stream[position++ % stream.size()];
+        now = next_stamp(now, value);
+        while (!deque.is_empty() && now - deque.peek_front().stamp >= span) {
+            deque.pop_front();
+        }
+        deque.push_back(TimedValue{value, now});
+
+        long long aggregate = Op::identity();
+        deque.for_each([&aggregate](const TimedValue& entry) {
+            aggregate = Op::combine(aggregate, entry.value);
+        });
+        checksum += aggregate;
+    }
+    return elapsed_ns(start) / steps;
+}
+
+template <typename Op>
+static void bench(const char* name, const std::vector<long long>& stream) {
+    std::cout << name << std::endl;
+    for (std::size_t window = 100; window <= g_maxWindow; window *= 10) {
+        long long checksum = 0;
+        double rescan = bench_rescan<Op>(stream, window, checksum);
+        double sliding = bench_window<Op>(stream, window, checksum);
+        std::cout << "  window " << window << ": Deque rescan " << rescan << " ns/step | SlidingWindow "
+                  << sliding << " ns/step | " << rescan / sliding << "x  (checksum " << checksum << ")" << std::endl;
+    }
+    for (std::size_t span = 100; span <= g_maxWindow; span *= 10) {
+        long long checksum = 0;
+        double rescan = bench_timed_rescan<Op>(stream, span, checksum);
+        double sliding = bench_timed_window<Op>(stream, span, checksum);
+        std::cout << "  last " << span << " ticks: Deque rescan " << rescan << " ns/step | SlidingWindow "
+                  << sliding << " ns/step | " << rescan / sliding << "x  (checksum " << checksum << ")" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_steps = std::strtoull(argv[1], nullptr, 10);
+    if (argc > 2) g_maxWindow = std::strtoull(argv[2], nullptr, 10);
+    if (argc > 3) g_rescanBudget = std::strtoull(argv[3], nullptr, 10);
+
+    std::cout << "steps: " << g_steps << " | windows: 100.." << g_maxWindow
+              << " | rescan budget: " << g_rescanBudget << " elements" << std::endl;
+    std::cout << std::endl;
+
+    std::mt19937_64 rng(42);
+    std::vector<long long> stream(1 << 20);
+    for (std::size_t i = 0; i < stream.size(); i++) {
+        stream[i] = static_cast<long long>(rng() % 1000000);
+    }
+
+    bench<DSA::WindowSum<long long>>("sum (two stacks)", stream);
+    std::cout << std::endl;
+    bench<DSA::WindowMax<long long>>("max (monotonic ring)", stream);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <iostream>
+#include "SlidingWindow.hpp"
+
+int main() {
+    DSA::SlidingWindow<int> sum(3);
+    DSA::SlidingWindow<int, DSA::WindowMin<int>> min(3);
+    DSA::SlidingWindow<int, DSA::WindowMax<int>> max(3);
+    std::cout << "Initialized count-based Sliding Windows of the last 3 elements" << std::endl << std::endl;
+
+    int values[] = {5, 1, 4, 8, 2, 7, 3};
+    for (int value : values) {
+        sum.push(value);
+        min.push(value);
+        max.push(value);
+        std::cout << value << " is pushed via push()" << std::endl;
+        std::cout << "SIZE: " << sum.size() << " | SUM: " << sum.query() << " | MIN: " << min.query()
+                  << " | MAX: " << max.query() << std::endl;
+    }
+    std::cout << "EXPECT: the last 3 elements are 2, 7, 3 with SUM 12, MIN 2 and MAX 7" << std::endl << std::endl;
+
+    sum.evict();
+    min.evict();
+    max.evict();
+    std::cout << "The oldest element is evicted via evict()" << std::endl;
+    std::cout << "SIZE: " << sum.size() << " | SUM: " << sum.query() << " | MIN: " << min.query()
+              << " | MAX: " << max.query() << std::endl << std::endl;
+
+    DSA::SlidingWindow<int> rate(0, 10);
+    std::cout << "Initialized a time-based Sliding Window that spans 10 ticks" << std::endl;
+    rate.push(1, 0);
+    rate.push(1, 4);
+    rate.push(1, 9);
+    std::cout << "Events are pushed at ticks 0, 4 and 9 via push()" << std::endl;
+    std::cout << "SIZE: " << rate.size() << " | EVENTS IN WINDOW: " << rate.query() << std::endl;
+
+    rate.advance(12);
+    std::cout << "The clock is moved to tick 12 via advance()" << std::endl;
+    std::cout << "EXPECT: the event at tick 0 has left the window" << std::endl;
+    std::cout << "SIZE: " << rate.size() << " | EVENTS IN WINDOW: " << rate.query() << std::endl;
+
+    rate.advance(30);
+    std::cout << "The clock is moved to tick 30 via advance()" << std::endl;
+    std::cout << "SIZE: " << rate.size() << " | EVENTS IN WINDOW: " << rate.query() << std::endl;
+    return 0;
+}
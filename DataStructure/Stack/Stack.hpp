@@ -17,10 +17,19 @@ namespace DSA {
         StackNode<T>* m_top;
         std::size_t m_size;
 
+        void _clear();
+
     public:
         Stack();
+        Stack(const Stack<T>& other);
+        Stack(Stack<T>&& other) noexcept;
+        Stack<T>& operator=(const Stack<T>& other);
+        Stack<T>& operator=(Stack<T>&& other) noexcept;
 
         void push(const T& value);
+        void push(T&& value);
+        template <typename... Args>
+        void emplace(Args&&... args);
         void pop();
 
         const T& peek() const;
@@ -3,10 +3,21 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 
 #include "Stack.hpp"
 
 namespace DSA {
+    template <typename T>
+    void Stack<T>::_clear() {
+        while (!is_empty()) {
+            StackNode<T>* previousTopElement = m_top;
+            m_top = m_top->next;
+            delete previousTopElement;
+            m_size--;
+        }
+    }
+
     template <typename T>
     Stack<T>::Stack() {
         m_top = nullptr;
@@ -14,10 +25,70 @@ namespace DSA {
     }
 
     template <typename T>
-    void Stack<T>::push(const T &value) {
-        StackNode<T>* newNode = new StackNode<T>();
-        newNode->data = value;
-        newNode->next = m_top;
+    Stack<T>::Stack(const Stack<T>& other) {
+        m_top = nullptr;
+        m_size = 0;
+
+        // Append below the last copied node so the copy keeps the same order.
+        StackNode<T>** tail = &m_top;
+        try {
+            for (StackNode<T>* cursor = other.m_top; cursor != nullptr; cursor = cursor->next) {
+                *tail = new StackNode<T>{cursor->data, nullptr};
+                tail = &(*tail)->next;
+                m_size++;
+            }
+        }
+        catch (...) {
+            _clear();
+            throw;
+        }
+    }
+
+    template <typename T>
+    Stack<T>::Stack(Stack<T>&& other) noexcept {
+        m_top = other.m_top;
+        m_size = other.m_size;
+        other.m_top = nullptr;
+        other.m_size = 0;
+    }
+
+    template <typename T>
+    Stack<T>& Stack<T>::operator=(const Stack<T>& other) {
+        if (this != &other) {
+            Stack<T> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    Stack<T>& Stack<T>::operator=(Stack<T>&& other) noexcept {
+        if (this != &other) {
+            _clear();
+            m_top = other.m_top;
+            m_size = other.m_size;
+            other.m_top = nullptr;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    void Stack<T>::push(const T& value) {
+        emplace(value);
+    }
+
+    template <typename T>
+    void Stack<T>::push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void Stack<T>::emplace(Args&&... args) {
+        StackNode<T>* newNode = new StackNode<T>{T(std::forward<Args>(args)...), m_top};
         m_top = newNode;
         m_size++;
     }
@@ -51,12 +122,7 @@ namespace DSA {
 
     template <typename T>
     Stack<T>::~Stack() {
-        while (!is_empty()) {
-            StackNode<T>* previousTopElement = m_top;
-            m_top = m_top->next;
-            delete previousTopElement;
-            m_size--;
-        }
+        _clear();
     }
 }
 
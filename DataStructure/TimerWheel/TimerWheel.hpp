@@ -0,0 +1,95 @@
+#ifndef CPPDSA_DATA_STRUCTURE_TIMER_WHEEL_HPP_
+#define CPPDSA_DATA_STRUCTURE_TIMER_WHEEL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include "../DynamicArray/DynamicArray.hpp"
+#include "../NodePool/NodePool.hpp"
+
+namespace DSA {
+    // A hierarchical hashed timing wheel. Time is measured in integer ticks.
+    // Level 0 has one slot per tick, and every higher level has one slot per
+    // full rotation of the level below it. A timer is hashed into the lowest
+    // level that can hold its remaining delay and moves down one level at a
+    // time as the wheel turns, so scheduling and cancelling are O(1). Every
+    // level keeps a bitmap of its non-empty slots, which lets advance() jump
+    // straight to the next tick that has work instead of visiting idle ones.
+    template <typename T>
+    class TimerWheel {
+    public:
+        typedef std::uint64_t TimerId;
+
+    private:
+        static constexpr std::size_t _SLOT_BITS = 8;
+        static constexpr std::size_t _SLOT_COUNT = std::size_t(1) << _SLOT_BITS;
+        static constexpr std::size_t _SLOT_MASK = _SLOT_COUNT - 1;
+        static constexpr std::size_t _LEVEL_COUNT = 4;
+        // Slot tag of timers that were taken off the wheel and are about to
+        // fire. Each advance() call keeps them behind a sentinel node of its
+        // own, so they always have a predecessor and can be unlinked without
+        // knowing which list they are on, even when advance() is re-entered
+        // from a callback.
+        static constexpr std::uint32_t _FIRING_SLOT = _LEVEL_COUNT * _SLOT_COUNT;
+
+        // Nodes live in a NodePool and are linked by index, so the slot lists
+        // are intrusive and growing the pool never moves a node. The payload
+        // is only constructed while the timer is pending.
+        template <typename U>
+        struct TimerNode {
+            union {
+                U data;
+            };
+            std::uint64_t expiry;
+            std::uint32_t next;
+            std::uint32_t prev;
+            std::uint32_t slot;
+
+            TimerNode() {}
+            ~TimerNode() {}
+        };
+
+        static constexpr std::uint32_t _NIL = NodePool<TimerNode<T>>::NIL;
+
+        NodePool<TimerNode<T>> m_pool;
+        // Bumped when a timer is scheduled into a pool slot and again when it
+        // leaves, so an odd value marks a pending timer and a stale TimerId
+        // never matches the slot's next occupant.
+        DynamicArray<std::uint32_t> m_generations;
+        std::uint32_t m_slots[_LEVEL_COUNT * _SLOT_COUNT];
+        std::uint64_t m_occupied[_LEVEL_COUNT * _SLOT_COUNT / 64];
+        std::uint64_t m_current;
+        std::size_t m_size;
+
+        static std::size_t _countr_zero(const std::uint64_t bits);
+
+        void _free(const std::uint32_t index);
+
+        void _link(const std::uint32_t index);
+        void _unlink(const std::uint32_t index);
+        void _cascade(const std::size_t level);
+        std::size_t _next_occupied(const std::size_t level, const std::size_t from) const;
+        std::uint64_t _next_event() const;
+
+    public:
+        TimerWheel(const std::uint64_t now = 0);
+        TimerWheel(const TimerWheel<T>& other) = delete;
+        TimerWheel<T>& operator=(const TimerWheel<T>& other) = delete;
+
+        template <typename... Args>
+        TimerId schedule(const std::uint64_t expiry, Args&&... args);
+        bool cancel(const TimerId id);
+
+        template <typename Callback>
+        std::size_t advance(const std::uint64_t now, Callback callback);
+
+        std::uint64_t now() const;
+        bool is_empty() const;
+        std::size_t size() const;
+
+        ~TimerWheel();
+    };
+}
+
+#include "TimerWheel.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_TIMER_WHEEL_HPP_
@@ -0,0 +1,321 @@
+#ifndef CPPDSA_DATA_STRUCTURE_TIMER_WHEEL_IPP_
+#define CPPDSA_DATA_STRUCTURE_TIMER_WHEEL_IPP_
+
+#if __has_include(<bit>)
+#include <bit>
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../DynamicArray/DynamicArray.hpp"
+#include "../NodePool/NodePool.hpp"
+#include "TimerWheel.hpp"
+
+namespace DSA {
+    // Index of the lowest set bit. std::countr_zero is only available from
+    // C++20 onwards. `bits` must not be zero.
+    template <typename T>
+    inline std::size_t TimerWheel<T>::_countr_zero(const std::uint64_t bits) {
+#if defined(__cpp_lib_bitops)
+        return static_cast<std::size_t>(std::countr_zero(bits));
+#elif defined(__GNUC__)
+        return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+        std::size_t count = 0;
+        while ((bits >> count & 1) == 0) {
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    template <typename T>
+    void TimerWheel<T>::_free(const std::uint32_t index) {
+        m_pool[index].data.~T();
+        m_generations[index]++;
+        m_pool.destroy(index);
+    }
+
+    template <typename T>
+    void TimerWheel<T>::_link(const std::uint32_t index) {
+        TimerNode<T>& node = m_pool[index];
+        const std::uint64_t delta = node.expiry - m_current;
+
+        // Pick the lowest level whose rotation covers the remaining delay.
+        // Anything beyond the top level parks there and is rehashed each time
+        // its slot comes around.
+        std::size_t level = 0;
+        while (level + 1 < _LEVEL_COUNT && delta >= (std::uint64_t(1) << (_SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+
+        const std::uint32_t slot = static_cast<std::uint32_t>(level * _SLOT_COUNT + ((node.expiry >> (_SLOT_BITS * level)) & _SLOT_MASK));
+        std::uint32_t& head = m_slots[slot];
+
+        node.slot = slot;
+        node.prev = _NIL;
+        node.next = head;
+        if (head != _NIL) {
+            m_pool[head].prev = index;
+        }
+        head = index;
+        m_occupied[slot / 64] |= std::uint64_t(1) << (slot % 64);
+    }
+
+    template <typename T>
+    void TimerWheel<T>::_unlink(const std::uint32_t index) {
+        TimerNode<T>& node = m_pool[index];
+
+        // Only the first timer of a wheel slot has no predecessor; a firing
+        // timer always follows its sentinel.
+        if (node.prev == _NIL) {
+            m_slots[node.slot] = node.next;
+            if (node.next == _NIL) {
+                m_occupied[node.slot / 64] &= ~(std::uint64_t(1) << (node.slot % 64));
+            }
+        }
+        else {
+            m_pool[node.prev].next = node.next;
+        }
+
+        if (node.next != _NIL) {
+            m_pool[node.next].prev = node.prev;
+        }
+    }
+
+    template <typename T>
+    void TimerWheel<T>::_cascade(const std::size_t level) {
+        const std::size_t slot = level * _SLOT_COUNT + ((m_current >> (_SLOT_BITS * level)) & _SLOT_MASK);
+        std::uint32_t cursor = m_slots[slot];
+        m_slots[slot] = _NIL;
+        m_occupied[slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+
+        while (cursor != _NIL) {
+            const std::uint32_t next = m_pool[cursor].next;
+            _link(cursor);
+            cursor = next;
+        }
+    }
+
+    // Returns how many slots past `from` the first non-empty slot of `level`
+    // is, wrapping around the level, or _SLOT_COUNT if the level is empty.
+    template <typename T>
+    std::size_t TimerWheel<T>::_next_occupied(const std::size_t level, const std::size_t from) const {
+        const std::uint64_t* words = m_occupied + level * (_SLOT_COUNT / 64);
+        const std::size_t wordCount = _SLOT_COUNT / 64;
+
+        // The first word is visited twice: the bits at or after `from`, and
+        // after wrapping around, the bits before it.
+        for (std::size_t i = 0; i <= wordCount; i++) {
+            const std::size_t word = (from / 64 + i) % wordCount;
+            std::uint64_t bits = words[word];
+            if (i == 0) {
+                bits &= ~std::uint64_t(0) << (from % 64);
+            }
+            else if (i == wordCount) {
+                bits &= ~(~std::uint64_t(0) << (from % 64));
+            }
+
+            if (bits != 0) {
+                const std::size_t slot = word * 64 + _countr_zero(bits);
+                return (slot + _SLOT_COUNT - from) & _SLOT_MASK;
+            }
+        }
+
+        return _SLOT_COUNT;
+    }
+
+    // Earliest tick at or after m_current where a level-0 slot fires or a
+    // higher-level slot cascades.
+    template <typename T>
+    std::uint64_t TimerWheel<T>::_next_event() const {
+        std::uint64_t next = ~std::uint64_t(0);
+
+        for (std::size_t level = 0; level < _LEVEL_COUNT; level++) {
+            const std::size_t shift = _SLOT_BITS * level;
+            const std::uint64_t rotation = m_current >> shift;
+            // A slot of a higher level is only visited on a rotation boundary,
+            // so the current slot is in the past unless we sit on one.
+            const std::size_t start = ((m_current & ((std::uint64_t(1) << shift) - 1)) == 0) ? 0 : 1;
+            const std::size_t offset = _next_occupied(level, (rotation + start) & _SLOT_MASK);
+
+            if (offset != _SLOT_COUNT) {
+                const std::uint64_t tick = (rotation + start + offset) << shift;
+                if (tick < next) {
+                    next = tick;
+                }
+            }
+        }
+
+        return next;
+    }
+
+    template <typename T>
+    TimerWheel<T>::TimerWheel(const std::uint64_t now) {
+        for (std::size_t i = 0; i < _LEVEL_COUNT * _SLOT_COUNT; i++) {
+            m_slots[i] = _NIL;
+        }
+        for (std::size_t i = 0; i < _LEVEL_COUNT * _SLOT_COUNT / 64; i++) {
+            m_occupied[i] = 0;
+        }
+        m_current = now + 1;
+        m_size = 0;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    typename TimerWheel<T>::TimerId TimerWheel<T>::schedule(const std::uint64_t expiry, Args&&... args) {
+        const std::uint32_t index = m_pool.create();
+        TimerNode<T>& node = m_pool[index];
+
+        try {
+            // The pool hands out fresh indices in order. Some of them may have
+            // gone to firing sentinels, which have no generation of their own.
+            while (m_generations.size() <= index) {
+                m_generations.push_back(0);
+            }
+            new (&node.data) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            m_pool.destroy(index);
+            throw;
+        }
+
+        // Timers that are already due fire on the next tick.
+        node.expiry = (expiry < m_current) ? m_current : expiry;
+        _link(index);
+        m_size++;
+
+        const std::uint32_t generation = ++m_generations[index];
+        return (static_cast<TimerId>(generation) << 32) | index;
+    }
+
+    template <typename T>
+    bool TimerWheel<T>::cancel(const TimerId id) {
+        const std::uint32_t index = static_cast<std::uint32_t>(id & 0xFFFFFFFFu);
+        const std::uint32_t generation = static_cast<std::uint32_t>(id >> 32);
+
+        if (index >= m_generations.size() || (generation & 1) == 0 || m_generations[index] != generation) {
+            return false;
+        }
+
+        // A timer whose callback is running has already left every list.
+        TimerNode<T>& node = m_pool[index];
+        if (node.slot == _NIL) {
+            return false;
+        }
+
+        _unlink(index);
+        _free(index);
+        m_size--;
+        return true;
+    }
+
+    template <typename T>
+    template <typename Callback>
+    std::size_t TimerWheel<T>::advance(const std::uint64_t now, Callback callback) {
+        std::size_t expired = 0;
+        // The sentinel carries no payload and has no generation bump, so
+        // cancel() and the destructor never mistake it for a timer.
+        const std::uint32_t firing = m_pool.create();
+        m_pool[firing].next = _NIL;
+
+        try {
+            while (m_current <= now) {
+                // Skipping ahead is safe because every tick in between would have
+                // cascaded or fired an empty slot.
+                const std::uint64_t next = (m_size == 0) ? ~std::uint64_t(0) : _next_event();
+                if (next > now) {
+                    m_current = now + 1;
+                    break;
+                }
+                m_current = next;
+
+                // Higher levels go first so that their timers can land in a lower
+                // slot that is cascaded or fired during this very tick.
+                for (std::size_t level = _LEVEL_COUNT - 1; level > 0; level--) {
+                    if ((m_current & ((std::uint64_t(1) << (_SLOT_BITS * level)) - 1)) == 0) {
+                        _cascade(level);
+                    }
+                }
+
+                // Detach the due slot before running any callback, so that timers
+                // scheduled from inside a callback are never fired in the same pass.
+                const std::size_t slot = m_current & _SLOT_MASK;
+                const std::uint32_t head = m_slots[slot];
+                m_slots[slot] = _NIL;
+                m_occupied[slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+                m_pool[firing].next = head;
+                if (head != _NIL) {
+                    m_pool[head].prev = firing;
+                }
+                for (std::uint32_t cursor = head; cursor != _NIL; cursor = m_pool[cursor].next) {
+                    m_pool[cursor].slot = _FIRING_SLOT;
+                }
+                m_current++;
+
+                while (m_pool[firing].next != _NIL) {
+                    const std::uint32_t index = m_pool[firing].next;
+                    TimerNode<T>& node = m_pool[index];
+                    _unlink(index);
+                    node.slot = _NIL;
+                    m_size--;
+                    expired++;
+
+                    try {
+                        callback(node.data);
+                    }
+                    catch (...) {
+                        _free(index);
+                        // Put the rest of this tick back on the wheel as due.
+                        while (m_pool[firing].next != _NIL) {
+                            const std::uint32_t pending = m_pool[firing].next;
+                            _unlink(pending);
+                            m_pool[pending].expiry = m_current;
+                            _link(pending);
+                        }
+                        throw;
+                    }
+                    _free(index);
+                }
+            }
+        }
+        catch (...) {
+            m_pool.destroy(firing);
+            throw;
+        }
+
+        m_pool.destroy(firing);
+        return expired;
+    }
+
+    template <typename T>
+    inline std::uint64_t TimerWheel<T>::now() const {
+        return m_current - 1;
+    }
+
+    template <typename T>
+    inline bool TimerWheel<T>::is_empty() const {
+        return m_size == 0;
+    }
+
+    template <typename T>
+    inline std::size_t TimerWheel<T>::size() const {
+        return m_size;
+    }
+
+    template <typename T>
+    TimerWheel<T>::~TimerWheel() {
+        for (std::size_t i = 0; i < m_generations.size(); i++) {
+            if ((m_generations[i] & 1) != 0) {
+                const std::uint32_t index = static_cast<std::uint32_t>(i);
+                m_pool[index].data.~T();
+                m_pool.destroy(index);
+            }
+        }
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_TIMER_WHEEL_IPP_
@@ -0,0 +1,214 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../Benchmark/Timer.hpp"
+#include "../PriorityQueue/PriorityQueue.hpp"
+#include "TimerWheel.hpp"
+
+// Simulates a connection-timeout workload: a steady population of pending
+// timers where, on every tick, some timers are cancelled (the connection saw
+// traffic), new ones are scheduled, and the due ones expire. PriorityQueue
+// cannot cancel, so it uses lazy deletion: cancelled entries stay in the heap
+// and are discarded when they reach the top. An operation is one schedule,
+// cancel or expiry.
+//
+// The time spent in each phase of a tick is reported separately, because the
+// two schedulers put the cost in different places. A lazy cancel costs the
+// heap nothing up front, while the wheel unlinks the timer right away and
+// touches its neighbours in the slot list, which are scattered across memory.
+// With a large population and a noticeable cancel rate the heap is therefore
+// faster overall, even though the wheel expires timers far more cheaply than
+// the heap pops them. The heap pays in memory instead: every cancelled entry
+// stays in it until its expiry comes around, which is reported as stale
+// entries. With no cancels the wheel comes out slightly ahead.
+
+static std::size_t g_pending = 1000000;
+static std::size_t g_ticks = 1000;
+static std::uint64_t g_horizon = 30000;
+static double g_cancelRatio = 0.01;
+
+// Handles are small integers shared by both schedulers, so the bookkeeping
+// needed to pick a random live timer costs the same on both sides.
+struct TimerBook {
+    std::vector<std::uint32_t> live;
+    std::vector<std::uint32_t> livePosition;
+    std::vector<std::uint32_t> generation;
+    std::vector<std::uint64_t> wheelId;
+    std::vector<std::uint32_t> freeHandles;
+
+    std::uint32_t acquire() {
+        std::uint32_t handle;
+        if (freeHandles.empty()) {
+            handle = static_cast<std::uint32_t>(generation.size());
+            livePosition.push_back(0);
+            generation.push_back(0);
+            wheelId.push_back(0);
+        }
+        else {
+            handle = freeHandles.back();
+            freeHandles.pop_back();
+        }
+
+        livePosition[handle] = static_cast<std::uint32_t>(live.size());
+        live.push_back(handle);
+        return handle;
+    }
+
+    void release(std::uint32_t handle) {
+        const std::uint32_t position = livePosition[handle];
+        live[position] = live.back();
+        livePosition[live[position]] = position;
+        live.pop_back();
+        generation[handle]++;
+        freeHandles.push_back(handle);
+    }
+};
+
+struct HeapEntry {
+    std::uint64_t expiry;
+    std::uint32_t handle;
+    std::uint32_t generation;
+
+    bool operator<(const HeapEntry& other) const { return expiry < other.expiry; }
+    bool operator>(const HeapEntry& other) const { return expiry > other.expiry; }
+};
+
+// Milliseconds spent in each phase of a tick, summed over the run.
+struct PhaseTimes {
+    double cancel;
+    double expire;
+    double schedule;
+};
+
+static void report(const char* name, double totalMs, const PhaseTimes& phases, std::size_t operations, std::size_t expired, std::size_t extra) {
+    std::cout << name << std::endl;
+    std::cout << "  total: " << totalMs << " ms | " << totalMs * 1e6 / operations << " ns/op" << std::endl;
+    std::cout << "  cancel: " << phases.cancel << " ms | expire: " << phases.expire << " ms | schedule: " << phases.schedule << " ms" << std::endl;
+    std::cout << "  expired: " << expired << " | stale heap entries left: " << extra << std::endl;
+}
+
+static void bench_priority_queue() {
+    std::mt19937_64 rng(1);
+    TimerBook book;
+    DSA::PriorityQueue<HeapEntry> queue(DSA::PriorityQueue<HeapEntry>::min_queue);
+    std::uint64_t now = 0;
+    std::size_t operations = 0;
+    std::size_t expired = 0;
+
+    for (std::size_t i = 0; i < g_pending; i++) {
+        const std::uint32_t handle = book.acquire();
+        queue.insert(HeapEntry{now + 1 + rng() % g_horizon, handle, book.generation[handle]});
+    }
+
+    PhaseTimes phases = {0, 0, 0};
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t tick = 0; tick < g_ticks; tick++) {
+        now++;
+
+        std::chrono::steady_clock::time_point phase = std::chrono::steady_clock::now();
+        const std::size_t cancels = static_cast<std::size_t>(book.live.size() * g_cancelRatio);
+        for (std::size_t i = 0; i < cancels; i++) {
+            book.release(book.live[rng() % book.live.size()]);
+        }
+        phases.cancel += elapsed_ms(phase);
+
+        phase = std::chrono::steady_clock::now();
+        while (!queue.is_empty() && queue.peek().expiry <= now) {
+            const HeapEntry entry = queue.peek();
+            queue.pull();
+            if (book.generation[entry.handle] == entry.generation) {
+                book.release(entry.handle);
+                expired++;
+            }
+        }
+        phases.expire += elapsed_ms(phase);
+
+        phase = std::chrono::steady_clock::now();
+        while (book.live.size() < g_pending) {
+            const std::uint32_t handle = book.acquire();
+            queue.insert(HeapEntry{now + 1 + rng() % g_horizon, handle, book.generation[handle]});
+            operations++;
+        }
+        phases.schedule += elapsed_ms(phase);
+
+        operations += cancels;
+    }
+
+    operations += expired;
+    report("PriorityQueue (lazy cancel)", elapsed_ms(start), phases, operations, expired, queue.size() - book.live.size());
+}
+
+static TimerBook* g_book = nullptr;
+static std::size_t g_expired = 0;
+
+static void on_expire(std::uint32_t& handle) {
+    g_book->release(handle);
+    g_expired++;
+}
+
+static void bench_timer_wheel() {
+    std::mt19937_64 rng(1);
+    TimerBook book;
+    DSA::TimerWheel<std::uint32_t> wheel(0);
+    std::uint64_t now = 0;
+    std::size_t operations = 0;
+
+    g_book = &book;
+    g_expired = 0;
+
+    for (std::size_t i = 0; i < g_pending; i++) {
+        const std::uint32_t handle = book.acquire();
+        book.wheelId[handle] = wheel.schedule(now + 1 + rng() % g_horizon, handle);
+    }
+
+    PhaseTimes phases = {0, 0, 0};
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t tick = 0; tick < g_ticks; tick++) {
+        now++;
+
+        std::chrono::steady_clock::time_point phase = std::chrono::steady_clock::now();
+        const std::size_t cancels = static_cast<std::size_t>(book.live.size() * g_cancelRatio);
+        for (std::size_t i = 0; i < cancels; i++) {
+            const std::uint32_t handle = book.live[rng() % book.live.size()];
+            wheel.cancel(book.wheelId[handle]);
+            book.release(handle);
+        }
+        phases.cancel += elapsed_ms(phase);
+
+        phase = std::chrono::steady_clock::now();
+        operations += wheel.advance(now, on_expire);
+        phases.expire += elapsed_ms(phase);
+
+        phase = std::chrono::steady_clock::now();
+        while (book.live.size() < g_pending) {
+            const std::uint32_t handle = book.acquire();
+            book.wheelId[handle] = wheel.schedule(now + 1 + rng() % g_horizon, handle);
+            operations++;
+        }
+        phases.schedule += elapsed_ms(phase);
+
+        operations += cancels;
+    }
+
+    report("TimerWheel", elapsed_ms(start), phases, operations, g_expired, 0);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_pending = std::strtoull(argv[1], nullptr, 10);
+    if (argc > 2) g_ticks = std::strtoull(argv[2], nullptr, 10);
+    if (argc > 3) g_horizon = std::strtoull(argv[3], nullptr, 10);
+    if (argc > 4) g_cancelRatio = std::strtod(argv[4], nullptr);
+
+    std::cout << "pending: " << g_pending << " | ticks: " << g_ticks << " | horizon: " << g_horizon
+              << " ticks | cancelled per tick: " << g_cancelRatio * 100 << "%" << std::endl;
+    std::cout << std::endl;
+
+    bench_priority_queue();
+    std::cout << std::endl;
+    bench_timer_wheel();
+    return 0;
+}
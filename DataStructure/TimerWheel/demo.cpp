@@ -0,0 +1,46 @@
+#include <iostream>
+#include <string>
+#include "TimerWheel.hpp"
+
+void printExpired(std::string& name) {
+    std::cout << "  EXPIRED: " << name << std::endl;
+}
+
+int main() {
+    DSA::TimerWheel<std::string> wheel(0);
+    std::cout << "Initialized Timer Wheel at tick " << wheel.now() << std::endl;
+    std::cout << std::endl;
+
+    wheel.schedule(5, "five");
+    wheel.schedule(10, "ten");
+    DSA::TimerWheel<std::string>::TimerId cancelled = wheel.schedule(10, "ten (cancelled)");
+    wheel.schedule(300, "three hundred");
+    wheel.schedule(70000, "seventy thousand");
+    std::cout << "Scheduled timers at ticks 5, 10, 10, 300 and 70000 via schedule()" << std::endl;
+    std::cout << "SIZE: " << wheel.size() << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Cancelled one of the timers at tick 10 via cancel(): " << wheel.cancel(cancelled) << std::endl;
+    std::cout << "Cancelling it again via cancel(): " << wheel.cancel(cancelled) << std::endl;
+    std::cout << "SIZE: " << wheel.size() << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Advanced to tick 10 via advance()" << std::endl;
+    std::size_t expired = wheel.advance(10, printExpired);
+    std::cout << "EXPIRED COUNT: " << expired << " | SIZE: " << wheel.size() << " | NOW: " << wheel.now() << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Advanced to tick 1000 via advance()" << std::endl;
+    expired = wheel.advance(1000, printExpired);
+    std::cout << "EXPIRED COUNT: " << expired << " | SIZE: " << wheel.size() << " | NOW: " << wheel.now() << std::endl;
+    std::cout << std::endl;
+
+    wheel.schedule(0, "already due");
+    std::cout << "Scheduled a timer at tick 0, which is already in the past" << std::endl;
+    std::cout << "Advanced to tick 100000 via advance()" << std::endl;
+    expired = wheel.advance(100000, printExpired);
+    std::cout << "EXPIRED COUNT: " << expired << " | SIZE: " << wheel.size() << " | NOW: " << wheel.now() << std::endl;
+    std::cout << std::endl;
+
+    return 0;
+}
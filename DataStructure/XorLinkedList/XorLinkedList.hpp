@@ -0,0 +1,73 @@
+#ifndef CPPDSA_DATA_STRUCTURE_XOR_LINKED_LIST_HPP_
+#define CPPDSA_DATA_STRUCTURE_XOR_LINKED_LIST_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include "../NodePool/NodePool.hpp"
+
+namespace DSA {
+    // A doubly linked list with the interface of LinkedList where every node
+    // stores a single link: the XOR of the indices of its previous and next
+    // nodes. Knowing where we came from is enough to find where to go next,
+    // so the list can still be walked in both directions from either end.
+    // Nodes live in a NodePool and are addressed by 32-bit indices.
+    template <typename T>
+    class XorLinkedList {
+    private:
+        template <typename U>
+        struct XorLinkedListNode {
+            U data;
+            std::uint32_t link;
+        };
+
+        static constexpr std::uint32_t _NIL = NodePool<XorLinkedListNode<T>>::NIL;
+
+        NodePool<XorLinkedListNode<T>> m_pool;
+        std::uint32_t m_head;
+        std::uint32_t m_tail;
+        std::size_t m_size;
+
+        void _get_reference(const std::size_t index, std::uint32_t& previous, std::uint32_t& current) const;
+        void _clear();
+
+    public:
+        XorLinkedList();
+        XorLinkedList(const XorLinkedList<T>& other);
+        XorLinkedList(XorLinkedList<T>&& other) noexcept;
+        XorLinkedList<T>& operator=(const XorLinkedList<T>& other);
+        XorLinkedList<T>& operator=(XorLinkedList<T>&& other) noexcept;
+
+        void push_front(const T& value);
+        void push_front(T&& value);
+        void push_back(const T& value);
+        void push_back(T&& value);
+        template <typename... Args>
+        void emplace_front(Args&&... args);
+        template <typename... Args>
+        void emplace_back(Args&&... args);
+        void pop_front();
+        void pop_back();
+        void insert_at(const std::size_t index, const T& value);
+        void insert_at(const std::size_t index, T&& value);
+        template <typename... Args>
+        void emplace_at(const std::size_t index, Args&&... args);
+        void remove_at(const std::size_t index);
+
+        const T& peek_front() const;
+        const T& peek_back() const;
+
+        std::size_t size() const;
+        bool is_empty() const;
+
+        T& operator[](const std::size_t index);
+
+        template <typename Callback>
+        void for_each(Callback callback) const;
+
+        ~XorLinkedList();
+    };
+}
+
+#include "XorLinkedList.ipp"
+
+#endif // CPPDSA_DATA_STRUCTURE_XOR_LINKED_LIST_HPP_
@@ -0,0 +1,319 @@
+#ifndef CPPDSA_DATA_STRUCTURE_XOR_LINKED_LIST_IPP_
+#define CPPDSA_DATA_STRUCTURE_XOR_LINKED_LIST_IPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include "../NodePool/NodePool.hpp"
+#include "XorLinkedList.hpp"
+
+namespace DSA {
+    // Finds the node at index together with the node before it, walking from
+    // whichever end is closer. Walking needs two cursors because a node's link
+    // only makes sense relative to one of its neighbours.
+    template <typename T>
+    void XorLinkedList<T>::_get_reference(const std::size_t index, std::uint32_t& previous, std::uint32_t& current) const {
+        if (index >= m_size) {
+            throw std::out_of_range("Index out of range.");
+        }
+
+        if (index <= m_size/2) {
+            previous = _NIL;
+            current = m_head;
+            for (std::size_t i = 0; i < index; i++) {
+                const std::uint32_t next = m_pool[current].link ^ previous;
+                previous = current;
+                current = next;
+            }
+        }
+        else {
+            std::uint32_t next = _NIL;
+            current = m_tail;
+            for (std::size_t i = m_size-1; i > index; i--) {
+                const std::uint32_t before = m_pool[current].link ^ next;
+                next = current;
+                current = before;
+            }
+            previous = m_pool[current].link ^ next;
+        }
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::_clear() {
+        std::uint32_t previous = _NIL;
+        std::uint32_t current = m_head;
+        while (current != _NIL) {
+            const std::uint32_t next = m_pool[current].link ^ previous;
+            m_pool.destroy(current);
+            previous = current;
+            current = next;
+        }
+
+        m_head = _NIL;
+        m_tail = _NIL;
+        m_size = 0;
+    }
+
+    template <typename T>
+    XorLinkedList<T>::XorLinkedList() {
+        m_head = _NIL;
+        m_tail = _NIL;
+        m_size = 0;
+    }
+
+    template <typename T>
+    XorLinkedList<T>::XorLinkedList(const XorLinkedList<T>& other) {
+        m_head = _NIL;
+        m_tail = _NIL;
+        m_size = 0;
+
+        std::uint32_t previous = _NIL;
+        std::uint32_t current = other.m_head;
+        try {
+            while (current != _NIL) {
+                push_back(other.m_pool[current].data);
+                const std::uint32_t next = other.m_pool[current].link ^ previous;
+                previous = current;
+                current = next;
+            }
+        }
+        catch (...) {
+            _clear();
+            throw;
+        }
+    }
+
+    template <typename T>
+    XorLinkedList<T>::XorLinkedList(XorLinkedList<T>&& other) noexcept : m_pool(std::move(other.m_pool)) {
+        m_head = other.m_head;
+        m_tail = other.m_tail;
+        m_size = other.m_size;
+        other.m_head = _NIL;
+        other.m_tail = _NIL;
+        other.m_size = 0;
+    }
+
+    template <typename T>
+    XorLinkedList<T>& XorLinkedList<T>::operator=(const XorLinkedList<T>& other) {
+        if (this != &other) {
+            XorLinkedList<T> copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    XorLinkedList<T>& XorLinkedList<T>::operator=(XorLinkedList<T>&& other) noexcept {
+        if (this != &other) {
+            _clear();
+            m_pool = std::move(other.m_pool);
+            m_head = other.m_head;
+            m_tail = other.m_tail;
+            m_size = other.m_size;
+            other.m_head = _NIL;
+            other.m_tail = _NIL;
+            other.m_size = 0;
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void XorLinkedList<T>::emplace_front(Args&&... args) {
+        const std::uint32_t newElement = m_pool.create(T(std::forward<Args>(args)...), _NIL ^ m_head);
+
+        if (is_empty()) {
+            m_tail = newElement;
+        }
+        else {
+            // The old head's previous neighbour changes from nothing to the new node.
+            m_pool[m_head].link ^= _NIL ^ newElement;
+        }
+        m_head = newElement;
+
+        m_size++;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void XorLinkedList<T>::emplace_back(Args&&... args) {
+        const std::uint32_t newElement = m_pool.create(T(std::forward<Args>(args)...), m_tail ^ _NIL);
+
+        if (is_empty()) {
+            m_head = newElement;
+        }
+        else {
+            m_pool[m_tail].link ^= _NIL ^ newElement;
+        }
+        m_tail = newElement;
+
+        m_size++;
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::pop_front() {
+        if (is_empty()) {
+            throw std::underflow_error("List is empty.");
+        }
+
+        const std::uint32_t oldHead = m_head;
+        m_head = m_pool[oldHead].link ^ _NIL;
+        m_pool.destroy(oldHead);
+        m_size--;
+
+        if (is_empty()) {
+            m_tail = _NIL;
+        }
+        else {
+            m_pool[m_head].link ^= oldHead ^ _NIL;
+        }
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::pop_back() {
+        if (is_empty()) {
+            throw std::underflow_error("List is empty.");
+        }
+
+        const std::uint32_t oldTail = m_tail;
+        m_tail = m_pool[oldTail].link ^ _NIL;
+        m_pool.destroy(oldTail);
+        m_size--;
+
+        if (is_empty()) {
+            m_head = _NIL;
+        }
+        else {
+            m_pool[m_tail].link ^= oldTail ^ _NIL;
+        }
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::insert_at(const std::size_t index, const T& value) {
+        emplace_at(index, value);
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::insert_at(const std::size_t index, T&& value) {
+        emplace_at(index, std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void XorLinkedList<T>::emplace_at(const std::size_t index, Args&&... args) {
+        if (index == 0) {
+            emplace_front(std::forward<Args>(args)...);
+        }
+        else if (index == m_size) {
+            emplace_back(std::forward<Args>(args)...);
+        }
+        else {
+            std::uint32_t preceedingElement;
+            std::uint32_t proceedingElement;
+            _get_reference(index, preceedingElement, proceedingElement);
+
+            const std::uint32_t newElement = m_pool.create(T(std::forward<Args>(args)...), preceedingElement ^ proceedingElement);
+            m_pool[preceedingElement].link ^= proceedingElement ^ newElement;
+            m_pool[proceedingElement].link ^= preceedingElement ^ newElement;
+
+            m_size++;
+        }
+    }
+
+    template <typename T>
+    void XorLinkedList<T>::remove_at(const std::size_t index) {
+        if (index >= m_size) {
+            throw std::out_of_range("Remove on out of range index.");
+        }
+
+        if (index == 0) {
+            pop_front();
+        }
+        else if (index == m_size-1) {
+            pop_back();
+        }
+        else {
+            std::uint32_t preceedingElement;
+            std::uint32_t elementToRemove;
+            _get_reference(index, preceedingElement, elementToRemove);
+            const std::uint32_t proceedingElement = m_pool[elementToRemove].link ^ preceedingElement;
+
+            m_pool[preceedingElement].link ^= elementToRemove ^ proceedingElement;
+            m_pool[proceedingElement].link ^= elementToRemove ^ preceedingElement;
+            m_pool.destroy(elementToRemove);
+
+            m_size--;
+        }
+    }
+
+    template <typename T>
+    inline const T& XorLinkedList<T>::peek_front() const {
+        return m_pool[m_head].data;
+    }
+
+    template <typename T>
+    inline const T& XorLinkedList<T>::peek_back() const {
+        return m_pool[m_tail].data;
+    }
+
+    template <typename T>
+    inline std::size_t XorLinkedList<T>::size() const {
+        return m_size;
+    }
+
+    template <typename T>
+    inline bool XorLinkedList<T>::is_empty() const {
+        return m_size == 0;
+    }
+
+    template <typename T>
+    T& XorLinkedList<T>::operator[](const std::size_t index) {
+        std::uint32_t previous;
+        std::uint32_t current;
+        _get_reference(index, previous, current);
+        return m_pool[current].data;
+    }
+
+    template <typename T>
+    template <typename Callback>
+    void XorLinkedList<T>::for_each(Callback callback) const {
+        std::uint32_t previous = _NIL;
+        std::uint32_t current = m_head;
+        while (current != _NIL) {
+            callback(m_pool[current].data);
+            const std::uint32_t next = m_pool[current].link ^ previous;
+            previous = current;
+            current = next;
+        }
+    }
+
+    template <typename T>
+    XorLinkedList<T>::~XorLinkedList() {
+        _clear();
+    }
+}
+
+#endif // CPPDSA_DATA_STRUCTURE_XOR_LINKED_LIST_IPP_
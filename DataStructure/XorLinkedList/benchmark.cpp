@@ -0,0 +1,64 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "../Benchmark/Benchmark.hpp"
+#include "../LinkedList/LinkedList.hpp"
+#include "XorLinkedList.hpp"
+
+// Number of elements.
+static std::size_t g_elements = 10000000;
+
+// Appends every element, walks the list front to back, then drains it from
+// the front. Both lists hold the same values.
+template <typename List>
+static void bench(const char* name) {
+    std::size_t baseBytes = g_liveBytes;
+    std::size_t baseBlocks = g_liveBlocks;
+
+    List* list = new List();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < g_elements; i++) {
+        list->push_back(static_cast<long long>(i));
+    }
+    double pushMs = elapsed_ms(start);
+
+    std::size_t bytes = g_liveBytes - baseBytes;
+    std::size_t blocks = g_liveBlocks - baseBlocks;
+
+    start = std::chrono::steady_clock::now();
+    long long iterateSum = 0;
+    list->for_each([&iterateSum](const long long& value) {
+        iterateSum += value;
+    });
+    double iterateMs = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    while (!list->is_empty()) {
+        list->pop_front();
+    }
+    double popMs = elapsed_ms(start);
+
+    std::cout << name << std::endl;
+    std::cout << "  heap:      " << static_cast<double>(bytes) / g_elements << " bytes/element, "
+              << static_cast<double>(blocks) / g_elements << " allocations/element" << std::endl;
+    std::cout << "  push_back: " << pushMs * 1e6 / g_elements << " ns/op" << std::endl;
+    std::cout << "  iterate:   " << iterateMs * 1e6 / g_elements << " ns/element" << std::endl;
+    std::cout << "  pop_front: " << popMs * 1e6 / g_elements << " ns/op" << std::endl;
+    std::cout << "  (checksum " << iterateSum << ")" << std::endl;
+
+    delete list;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_elements = std::strtoull(argv[1], nullptr, 10);
+
+    std::cout << "elements: " << g_elements << std::endl;
+    std::cout << std::endl;
+
+    bench<DSA::LinkedList<long long>>("LinkedList (two pointer links)");
+    std::cout << std::endl;
+    bench<DSA::XorLinkedList<long long>>("XorLinkedList (one 32-bit XOR link)");
+    return 0;
+}